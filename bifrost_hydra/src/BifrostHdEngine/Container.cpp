@@ -22,6 +22,7 @@
 
 #include <BifrostGraph/Executor/PreviewUtility.h>
 
+#include <algorithm>
 #include <iostream>
 
 namespace BifrostHd {
@@ -45,7 +46,18 @@ Container::createEvaluationRequirement(
             defaultVal);
     }
 
-    return new Requirement(name, direction, type, portClass, defaultVal);
+    size_t portIndex = Requirement::kNoPortIndex;
+    if (direction == BifrostGraph::Executor::PortDirection::kInput) {
+        auto found = std::find(m_inputPortNames.begin(),
+                               m_inputPortNames.end(), name.c_str());
+        portIndex  = static_cast<size_t>(found - m_inputPortNames.begin());
+        if (found == m_inputPortNames.end()) {
+            m_inputPortNames.emplace_back(name.c_str());
+        }
+    }
+
+    return new Requirement(name, direction, type, portClass, defaultVal,
+                           portIndex);
 }
 
 bool Container::initialize() {
@@ -118,4 +130,8 @@ Amino::Job::State Container::executeJob(JobTranslationData& translationData) {
         BifrostGraph::Executor::JobPreview::ExecuteFlags::kDefault);
 }
 
+const std::vector<std::string>& Container::inputPortNames() const {
+    return m_inputPortNames;
+}
+
 } // namespace BifrostHd
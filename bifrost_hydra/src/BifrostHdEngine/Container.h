@@ -22,6 +22,9 @@
 #include <BifrostGraph/Executor/GraphContainerPreview.h>
 #include <BifrostGraph/Executor/JobPreview.h>
 
+#include <string>
+#include <vector>
+
 namespace BifrostHd {
 class Runtime;
 class JobTranslationData;
@@ -46,6 +49,10 @@ public:
 
     Amino::Job::State executeJob(JobTranslationData& translationData);
 
+    /// The names of the input ports of the graph, indexed by the port index
+    /// given to their requirements.
+    const std::vector<std::string>& inputPortNames() const;
+
 public:
     /// Disabled
     /// \{
@@ -57,6 +64,8 @@ public:
 
 private:
     BifrostGraph::Executor::JobPreview m_job;
+    /// Filled when the requirements are populated.
+    mutable std::vector<std::string> m_inputPortNames;
 };
 
 } // namespace BifrostHd
@@ -23,6 +23,8 @@
 #include <BifrostHydra/Engine/JobTranslationData.h>
 #include <BifrostHydra/Engine/Parameters.h>
 
+#include <algorithm>
+
 namespace BifrostHd {
 
 class Engine::Impl {
@@ -30,21 +32,13 @@ public:
     Impl() = default;
 
     Amino::Job::State execute(const double frame) {
-        auto qualifiedName = Amino::String{m_parameters.compoundName().c_str()};
-
-        // Since for now we can't change the graph at runtime (no Bifrost Graph
-        // Editor "attached" to our runtime), loading of the graph should happen
-        // just once. Then, the user can only change input values so we only
-        // need execution.
-        if (m_container.graphExecutionCounter() == 0) {
-            if (!m_container.loadGraph(
-                    qualifiedName,
-                    BifrostGraph::Executor::GraphContainerPreview::GraphMode::kLoadAsReference)) {
-                return Amino::Job::State::kErrors;
-            }
-            if (!m_container.updateJob()) {
-                return Amino::Job::State::kErrors;
-            }
+        // The compiled job is borrowed from the runtime for the execution
+        // only, so that it is shared with the other engines executing the
+        // same compound. The per-engine data are the parameters.
+        auto container = BifrostHd::Runtime::getInstance().acquireContainer(
+            m_parameters.compoundName());
+        if (!container) {
+            return Amino::Job::State::kErrors;
         }
 
         const double currentTime = frame / m_fps;
@@ -54,23 +48,66 @@ public:
             m_parameters,
             /*logVerbose*/ true,
             /*Time data*/ {currentTime, frame, frameLength}};
-        return m_container.executeJob(jobTranslationData);
+        m_parameters.bindPorts(container->inputPortNames());
+        m_parameters.beginOutput();
+        const auto state = container->executeJob(jobTranslationData);
+        if (state == Amino::Job::State::kSuccess) {
+            m_parameters.commitOutput();
+        }
+        return state;
+    }
+
+    Amino::Job::State executeMotionSamples(const double   frame,
+                                           MotionOutputs& outputs) {
+        outputs.clear();
+
+        auto offsets = m_parameters.shutterOffsets();
+        std::sort(offsets.begin(), offsets.end());
+        offsets.erase(std::unique(offsets.begin(), offsets.end()),
+                      offsets.end());
+
+        for (const auto offset : offsets) {
+            if (offset == 0.0) {
+                continue;
+            }
+            auto state = execute(frame + offset);
+            if (state != Amino::Job::State::kSuccess) {
+                outputs.clear();
+                return state;
+            }
+            outputs.emplace_back(offset, m_parameters.output().second);
+        }
+        return Amino::Job::State::kSuccess;
     }
 
     void setInputScene(PXR_NS::HdSceneIndexBaseRefPtr inputScene) {
         m_parameters.setInputScene(std::move(inputScene));
     }
 
-    void setInputs(PXR_NS::HdSceneIndexPrim const& prim) {
-        m_parameters.setInputs(prim);
+    bool setInputs(PXR_NS::HdSceneIndexPrim const&       prim,
+                   const PXR_NS::HdDataSourceLocatorSet* dirtiedLocators) {
+        return m_parameters.setInputs(prim, dirtiedLocators);
     }
 
+    void dirtyInputPrims(const PXR_NS::SdfPathVector& paths) {
+        m_parameters.dirtyInputPrims(paths);
+    }
+
+    void convertInputMeshes() { m_parameters.convertInputMeshes(); }
+
     const Output& output() { return m_parameters.output(); }
 
+    double frame() const { return m_parameters.frame(); }
+
+    const std::vector<double>& shutterOffsets() const {
+        return m_parameters.shutterOffsets();
+    }
+
+    size_t inputsHash() const { return m_parameters.inputsHash(); }
+
 private:
     double               m_fps{24.0};
     Parameters           m_parameters;
-    BifrostHd::Container m_container{BifrostHd::Runtime::getInstance()};
 };
 
 Engine::Engine() : m_impl(std::make_unique<Impl>()) {}
@@ -81,14 +118,34 @@ void Engine::setInputScene(PXR_NS::HdSceneIndexBaseRefPtr inputScene) {
     m_impl->setInputScene(std::move(inputScene));
 }
 
-void Engine::setInputs(PXR_NS::HdSceneIndexPrim const& prim) {
-    m_impl->setInputs(prim);
+bool Engine::setInputs(PXR_NS::HdSceneIndexPrim const&       prim,
+                       const PXR_NS::HdDataSourceLocatorSet* dirtiedLocators) {
+    return m_impl->setInputs(prim, dirtiedLocators);
 }
 
+void Engine::dirtyInputPrims(const PXR_NS::SdfPathVector& paths) {
+    m_impl->dirtyInputPrims(paths);
+}
+
+void Engine::convertInputMeshes() { m_impl->convertInputMeshes(); }
+
+double Engine::frame() const { return m_impl->frame(); }
+
+const std::vector<double>& Engine::shutterOffsets() const {
+    return m_impl->shutterOffsets();
+}
+
+size_t Engine::inputsHash() const { return m_impl->inputsHash(); }
+
 Amino::Job::State Engine::execute(const double frame) {
     return m_impl->execute(frame);
 }
 
 const Output& Engine::output() { return m_impl->output(); }
 
+Amino::Job::State Engine::executeMotionSamples(const double   frame,
+                                               MotionOutputs& outputs) {
+    return m_impl->executeMotionSamples(frame, outputs);
+}
+
 } // namespace BifrostHd
@@ -22,9 +22,12 @@
 #include <Amino/AminoJob.h>
 #include <Bifrost/Object/Object.h>
 
+#include <pxr/imaging/hd/dataSourceLocator.h>
 #include <pxr/imaging/hd/sceneIndex.h>
 
 #include <memory>
+#include <utility>
+#include <vector>
 
 namespace BifrostHd {
 class Workspace;
@@ -38,6 +41,11 @@ class Workspace;
 using Output =
     std::pair<std::string, Amino::Array<Amino::Ptr<Bifrost::Object>>>;
 
+/// The graph outputs at shutter offsets around the executed frame, sorted by
+/// shutter offset.
+using MotionOutputs =
+    std::vector<std::pair<double, Amino::Array<Amino::Ptr<Bifrost::Object>>>>;
+
 class BIFROST_HD_ENGINE_SHARED_DECL Engine {
 public:
     Engine();
@@ -45,11 +53,43 @@ public:
     ~Engine();
 
     void setInputScene(PXR_NS::HdSceneIndexBaseRefPtr inputScene);
-    void setInputs(PXR_NS::HdSceneIndexPrim const& prim);
+    /// \returns true if the graph or its inputs changed since the previous
+    ///          call, so the graph must be executed again.
+    /// \see Parameters::setInputs()
+    bool setInputs(PXR_NS::HdSceneIndexPrim const&       prim,
+                   const PXR_NS::HdDataSourceLocatorSet* dirtiedLocators =
+                       nullptr);
+    /// Discards the cached conversions of the given dirtied prims of the
+    /// input scene, see Parameters::inputMesh().
+    void dirtyInputPrims(const PXR_NS::SdfPathVector& paths);
+    /// Converts the input meshes from the input scene, so that the graph
+    /// can then be executed on another thread without accessing the input
+    /// scene, see Parameters::convertInputMeshes().
+    void convertInputMeshes();
+
+    /// The frame, shutter offsets and inputs hash of the parameters, see
+    /// Parameters.
+    /// \{
+    double                     frame() const;
+    const std::vector<double>& shutterOffsets() const;
+    size_t                     inputsHash() const;
+    /// \}
 
     Amino::Job::State execute(const double frame = 0);
     const Output&     output();
 
+    /// Executes the graph at the frame offset by each of the non-zero
+    /// shutter offsets of the parameters, to motion blur its output. The
+    /// graph must still be executed at the frame itself with execute().
+    /// Only the frame given to the graph changes across the samples: the
+    /// inputs, including the input meshes, are those read by setInputs() at
+    /// the current time, so the motion of animated inputs is not sampled.
+    /// \param [in] frame The frame around which the graph is executed.
+    /// \param [out] outputs The graph outputs at each shutter offset.
+    /// \returns kSuccess if all the executions succeeded.
+    Amino::Job::State executeMotionSamples(const double   frame,
+                                           MotionOutputs& outputs);
+
 public:
     /// Disabled
     /// \{
@@ -16,7 +16,47 @@
 
 #include <BifrostHydra/Engine/Parameters.h>
 
+#include <BifrostHydra/Translators/GeometryFn.h>
+
+#include <pxr/base/tf/hash.h>
+#include <pxr/base/vt/types.h>
+#include <pxr/imaging/hd/meshSchema.h>
+#include <pxr/imaging/hd/meshTopologySchema.h>
 #include <pxr/imaging/hd/primvarsSchema.h>
+#include <pxr/imaging/hd/tokens.h>
+#include <pxr/usd/sdf/path.h>
+
+#include <optional>
+
+namespace {
+
+/// Hashes the content of a mesh of the input scene, as read by
+/// BifrostHd::CreateBifrostMesh.
+size_t hashInputMesh(const PXR_NS::HdSceneIndexBaseRefPtr& inputScene,
+                     const PXR_NS::SdfPath&                path) {
+    auto   prim = inputScene->GetPrim(path);
+    size_t hash = PXR_NS::TfHash{}(prim.primType);
+
+    auto primvars = PXR_NS::HdPrimvarsSchema::GetFromParent(prim.dataSource);
+    for (const auto& name : primvars.GetPrimvarNames()) {
+        if (auto dataSource = primvars.GetPrimvar(name).GetPrimvarValue()) {
+            hash = PXR_NS::TfHash::Combine(hash, name,
+                                           dataSource->GetValue(0.0f).GetHash());
+        }
+    }
+
+    auto topology = PXR_NS::HdMeshSchema::GetFromParent(prim.dataSource)
+                        .GetTopology();
+    if (auto counts = topology.GetFaceVertexCounts()) {
+        hash = PXR_NS::TfHash::Combine(hash, counts->GetTypedValue(0.0f));
+    }
+    if (auto indices = topology.GetFaceVertexIndices()) {
+        hash = PXR_NS::TfHash::Combine(hash, indices->GetTypedValue(0.0f));
+    }
+    return hash;
+}
+
+} // namespace
 
 namespace BifrostHd {
 
@@ -27,6 +67,9 @@ public:
     ~Impl() = default;
 
     void setInputScene(PXR_NS::HdSceneIndexBaseRefPtr inputScene) {
+        if (inputScene != m_inputScene) {
+            m_inputPrims.clear();
+        }
         m_inputScene = std::move(inputScene);
     }
 
@@ -34,41 +77,170 @@ public:
         return m_inputScene;
     }
 
-    void setInputs(PXR_NS::HdSceneIndexPrim const& prim) {
+    bool setInputs(PXR_NS::HdSceneIndexPrim const&      prim,
+                   const PXR_NS::HdDataSourceLocatorSet* dirtiedLocators) {
         auto primvarSchema =
             PXR_NS::HdPrimvarsSchema::GetFromParent(prim.dataSource);
+        auto names = primvarSchema.GetPrimvarNames();
+
+        // When the procedural prim has the same primvars, only the dirtied
+        // ones are read again.
+        if (m_hasInputs && dirtiedLocators && names == m_primvarNames) {
+            bool changed = false;
+            for (const auto& name : names) {
+                if (name == "hdGp:proceduralType" ||
+                    !dirtiedLocators->Intersects(
+                        PXR_NS::HdPrimvarsSchema::GetDefaultLocator().Append(
+                            name))) {
+                    continue;
+                }
+                if (auto dataSource =
+                        primvarSchema.GetPrimvar(name).GetPrimvarValue()) {
+                    changed |= setPrimvar(name, dataSource->GetValue(0.0f));
+                }
+            }
+            if (changed) {
+                ++m_inputsVersion;
+                eraseUnusedInputPrims();
+            }
+            return changed;
+        }
 
-        for (const auto& name : primvarSchema.GetPrimvarNames()) {
+        const std::string   compoundName = m_compound_name;
+        const std::string   outputName   = m_output.first;
+        const Inputs        inputs       = std::move(m_inputs);
+        const double        frame        = m_frame;
+        std::vector<double> shutterOffsets = std::move(m_shutterOffsets);
+        m_inputs.clear();
+        m_frame = 0.0;
+        m_shutterOffsets.clear();
+        for (const auto& name : names) {
             if (name == "hdGp:proceduralType") {
                 continue;
             }
 
             if (auto dataSource =
                     primvarSchema.GetPrimvar(name).GetPrimvarValue()) {
-                auto value = dataSource->GetValue(0.0f);
-                if (name == "bifrost:graph") {
-                    if (value.IsHolding<PXR_NS::TfToken>()) {
-                        const auto& graphName  = value.UncheckedGet<PXR_NS::TfToken>();
-                        m_compound_name = graphName.GetText();
-                    }
-                } else if (name == "bifrost:output") {
-                    if (value.GetTypeName() == "string") {
-                        auto output_name = value.UncheckedGet<std::string>();
-                        auto objectArray = Amino::Array<Amino::Ptr<Bifrost::Object>>();
-                        m_output         = std::make_pair(output_name, objectArray);
-                    }
-                } else {
-                    m_inputs[name.GetText()] = dataSource->GetValue(0.0f);
-                }
+                setPrimvar(name, dataSource->GetValue(0.0f));
             }
         }
+
+        bool changed = !m_hasInputs || compoundName != m_compound_name ||
+                       outputName != m_output.first || inputs != m_inputs ||
+                       frame != m_frame || shutterOffsets != m_shutterOffsets;
+        if (changed) {
+            eraseUnusedInputPrims();
+        }
+        // The inputs were all read again, even if they did not change.
+        ++m_inputsVersion;
+        m_primvarNames = std::move(names);
+        m_hasInputs    = true;
+        return changed;
     }
 
     const std::string& compoundName() const { return m_compound_name; }
 
+    double frame() const { return m_frame; }
+
+    const std::vector<double>& shutterOffsets() const {
+        return m_shutterOffsets;
+    }
+
+    size_t inputsHash() const {
+        size_t hash = PXR_NS::TfHash::Combine(m_compound_name, m_output.first,
+                                              m_shutterOffsets);
+        for (const auto& input : m_inputs) {
+            const auto& value = input.second;
+            hash = PXR_NS::TfHash::Combine(hash, input.first, value.GetHash());
+            if (m_inputScene &&
+                value.IsHolding<PXR_NS::VtArray<PXR_NS::SdfPath>>()) {
+                for (const auto& path :
+                     value.UncheckedGet<PXR_NS::VtArray<PXR_NS::SdfPath>>()) {
+                    auto& inputPrim = m_inputPrims[path];
+                    if (!inputPrim.hash) {
+                        inputPrim.hash = hashInputMesh(m_inputScene, path);
+                    }
+                    hash = PXR_NS::TfHash::Combine(hash, *inputPrim.hash);
+                }
+            }
+        }
+        return hash;
+    }
+
     const Inputs& inputs() const { return m_inputs; }
 
-    Output& output() { return m_output; }
+    void bindPorts(const std::vector<std::string>& portNames) {
+        if (m_boundPortNames == &portNames &&
+            m_portInputs.size() == portNames.size() &&
+            m_boundInputsVersion == m_inputsVersion) {
+            return;
+        }
+        m_portInputs.assign(portNames.size(), nullptr);
+        for (size_t i = 0; i < portNames.size(); ++i) {
+            auto found = m_inputs.find(portNames[i]);
+            if (found != m_inputs.end()) {
+                m_portInputs[i] = &found->second;
+            }
+        }
+        m_boundPortNames     = &portNames;
+        m_boundInputsVersion = m_inputsVersion;
+    }
+
+    const PXR_NS::VtValue* portInput(size_t portIndex) const {
+        return portIndex < m_portInputs.size() ? m_portInputs[portIndex]
+                                               : nullptr;
+    }
+
+    Amino::Ptr<Bifrost::Object> inputMesh(const PXR_NS::SdfPath& path) const {
+        if (!m_inputScene) {
+            return nullptr;
+        }
+        auto& inputPrim = m_inputPrims[path];
+        if (!inputPrim.converted) {
+            auto prim = m_inputScene->GetPrim(path);
+            if (prim.primType == PXR_NS::HdPrimTypeTokens->mesh) {
+                inputPrim.mesh = BifrostHd::CreateBifrostMesh(prim);
+            }
+            inputPrim.converted = true;
+        }
+        return inputPrim.mesh;
+    }
+
+    void convertInputMeshes() const {
+        for (const auto& input : m_inputs) {
+            const auto& value = input.second;
+            if (!value.IsHolding<PXR_NS::VtArray<PXR_NS::SdfPath>>()) {
+                continue;
+            }
+            // Only single paths are converted, see convertObject().
+            const auto& paths =
+                value.UncheckedGet<PXR_NS::VtArray<PXR_NS::SdfPath>>();
+            if (paths.size() == 1) {
+                inputMesh(paths[0]);
+            }
+        }
+    }
+
+    void dirtyInputPrims(const PXR_NS::SdfPathVector& paths) {
+        for (const auto& path : paths) {
+            m_inputPrims.erase(path);
+        }
+    }
+
+    const Output& output() const { return m_output; }
+
+    void beginOutput() {
+        // The back buffer holds the objects of the execution before the
+        // previous one, which are not read anymore.
+        m_backOutput.clear();
+        m_backOutput.reserve(m_output.second.size());
+    }
+
+    void addOutput(Amino::Ptr<Bifrost::Object> object) {
+        m_backOutput.push_back(std::move(object));
+    }
+
+    void commitOutput() { std::swap(m_output.second, m_backOutput); }
 
 public:
     /// Disabled
@@ -80,10 +252,104 @@ public:
     /// \}
 
 private:
+    /// Sets the value of a primvar of the procedural prim.
+    /// \returns true if the value changed.
+    bool setPrimvar(const PXR_NS::TfToken& name, PXR_NS::VtValue value) {
+        if (name == "bifrost:frame") {
+            double frame = 0.0;
+            if (value.CanCast<double>()) {
+                frame = PXR_NS::VtValue::Cast<double>(value)
+                            .UncheckedGet<double>();
+            }
+            const bool changed = frame != m_frame;
+            m_frame            = frame;
+            return changed;
+        } else if (name == "bifrost:motionSamples") {
+            std::vector<double> shutterOffsets;
+            if (value.IsHolding<PXR_NS::VtDoubleArray>()) {
+                const auto& offsets = value.UncheckedGet<PXR_NS::VtDoubleArray>();
+                shutterOffsets.assign(offsets.begin(), offsets.end());
+            } else if (value.IsHolding<PXR_NS::VtFloatArray>()) {
+                const auto& offsets = value.UncheckedGet<PXR_NS::VtFloatArray>();
+                shutterOffsets.assign(offsets.begin(), offsets.end());
+            }
+            const bool changed = shutterOffsets != m_shutterOffsets;
+            m_shutterOffsets   = std::move(shutterOffsets);
+            return changed;
+        } else if (name == "bifrost:graph") {
+            if (value.IsHolding<PXR_NS::TfToken>()) {
+                const std::string compoundName =
+                    value.UncheckedGet<PXR_NS::TfToken>().GetText();
+                const bool changed = compoundName != m_compound_name;
+                m_compound_name    = compoundName;
+                return changed;
+            }
+            return false;
+        } else if (name == "bifrost:output") {
+            if (value.IsHolding<std::string>()) {
+                const auto& outputName = value.UncheckedGet<std::string>();
+                const bool  changed    = outputName != m_output.first;
+                m_output.first         = outputName;
+                return changed;
+            }
+            return false;
+        }
+
+        auto& input = m_inputs[name.GetText()];
+        if (input == value) {
+            return false;
+        }
+        input = std::move(value);
+        return true;
+    }
+
+    /// The data read from a prim of the input scene.
+    struct InputPrim {
+        std::optional<size_t>       hash;
+        /// The converted mesh, nullptr if the prim is not a mesh.
+        Amino::Ptr<Bifrost::Object> mesh;
+        bool                        converted = false;
+    };
+
+    /// Discards the cached data of the prims that are not inputs anymore.
+    void eraseUnusedInputPrims() {
+        std::unordered_map<PXR_NS::SdfPath, InputPrim, PXR_NS::SdfPath::Hash>
+            inputPrims;
+        for (const auto& input : m_inputs) {
+            const auto& value = input.second;
+            if (!value.IsHolding<PXR_NS::VtArray<PXR_NS::SdfPath>>()) {
+                continue;
+            }
+            for (const auto& path :
+                 value.UncheckedGet<PXR_NS::VtArray<PXR_NS::SdfPath>>()) {
+                auto found = m_inputPrims.find(path);
+                if (found != m_inputPrims.end()) {
+                    inputPrims.insert(*found);
+                }
+            }
+        }
+        m_inputPrims = std::move(inputPrims);
+    }
+
     std::string m_compound_name;
     PXR_NS::HdSceneIndexBaseRefPtr m_inputScene;
     Inputs      m_inputs;
     Output      m_output;
+    /// The output objects of the running execution, see beginOutput().
+    Amino::Array<Amino::Ptr<Bifrost::Object>> m_backOutput;
+    double      m_frame     = 0.0;
+    std::vector<double> m_shutterOffsets;
+    bool        m_hasInputs = false;
+    mutable std::unordered_map<PXR_NS::SdfPath, InputPrim, PXR_NS::SdfPath::Hash>
+        m_inputPrims;
+    PXR_NS::TfTokenVector m_primvarNames;
+    /// Incremented each time the inputs are read again.
+    size_t m_inputsVersion = 0;
+
+    /// The inputs of the ports given to bindPorts().
+    std::vector<const PXR_NS::VtValue*> m_portInputs;
+    const std::vector<std::string>*     m_boundPortNames     = nullptr;
+    size_t                              m_boundInputsVersion = 0;
 };
 
 Parameters::Parameters() : m_impl(std::make_unique<Impl>()) {}
@@ -97,14 +363,53 @@ void Parameters::setInputScene(PXR_NS::HdSceneIndexBaseRefPtr inputScene) {
     m_impl->setInputScene(std::move(inputScene));
 }
 
-void Parameters::setInputs(PXR_NS::HdSceneIndexPrim const& prim) {
-    m_impl->setInputs(prim);
+bool Parameters::setInputs(
+    PXR_NS::HdSceneIndexPrim const&       prim,
+    const PXR_NS::HdDataSourceLocatorSet* dirtiedLocators) {
+    return m_impl->setInputs(prim, dirtiedLocators);
 }
 
 const std::string& Parameters::compoundName() const { return m_impl->compoundName(); }
 
+double Parameters::frame() const { return m_impl->frame(); }
+
+const std::vector<double>& Parameters::shutterOffsets() const {
+    return m_impl->shutterOffsets();
+}
+
+size_t Parameters::inputsHash() const { return m_impl->inputsHash(); }
+
 const Inputs& Parameters::inputs() const { return m_impl->inputs(); }
 
-Output& Parameters::output() { return m_impl->output(); }
+Amino::Ptr<Bifrost::Object> Parameters::inputMesh(
+    const PXR_NS::SdfPath& path) const {
+    return m_impl->inputMesh(path);
+}
+
+void Parameters::convertInputMeshes() const {
+    m_impl->convertInputMeshes();
+}
+
+void Parameters::bindPorts(const std::vector<std::string>& portNames) {
+    m_impl->bindPorts(portNames);
+}
+
+const PXR_NS::VtValue* Parameters::portInput(size_t portIndex) const {
+    return m_impl->portInput(portIndex);
+}
+
+void Parameters::dirtyInputPrims(const PXR_NS::SdfPathVector& paths) {
+    m_impl->dirtyInputPrims(paths);
+}
+
+const Output& Parameters::output() const { return m_impl->output(); }
+
+void Parameters::beginOutput() { m_impl->beginOutput(); }
+
+void Parameters::addOutput(Amino::Ptr<Bifrost::Object> object) {
+    m_impl->addOutput(std::move(object));
+}
+
+void Parameters::commitOutput() { m_impl->commitOutput(); }
 
 } // namespace BifrostHd
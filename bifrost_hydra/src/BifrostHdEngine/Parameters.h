@@ -21,10 +21,14 @@
 
 #include <Bifrost/Object/Object.h>
 
+#include <pxr/imaging/hd/dataSourceLocator.h>
 #include <pxr/imaging/hd/sceneIndex.h>
+#include <pxr/usd/sdf/path.h>
 
 #include <memory>
+#include <string>
 #include <unordered_map>
+#include <vector>
 
 namespace BifrostHd {
 
@@ -47,13 +51,80 @@ public:
 
     PXR_NS::HdSceneIndexBaseRefPtr inputScene() const;
 
-    void setInputs(PXR_NS::HdSceneIndexPrim const& prim);
+    /// Reads the graph name, output name and inputs from the primvars of
+    /// the procedural prim.
+    /// \param [in] prim The procedural prim.
+    /// \param [in] dirtiedLocators If given, only the primvars dirtied since
+    ///            the previous call are read again, unless primvars were
+    ///            added or removed.
+    /// \returns true if the graph name, the output name or the inputs
+    ///          changed since the previous call.
+    bool setInputs(PXR_NS::HdSceneIndexPrim const&       prim,
+                   const PXR_NS::HdDataSourceLocatorSet* dirtiedLocators =
+                       nullptr);
 
     const std::string& compoundName() const;
 
+    /// The frame at which the graph is executed, read from the optional
+    /// "bifrost:frame" primvar. It is 0 if there is no such primvar.
+    double frame() const;
+
+    /// The shutter offsets, in frames, at which the graph is also executed
+    /// to motion blur its output, read from the optional
+    /// "bifrost:motionSamples" primvar. It is empty if there is no such
+    /// primvar.
+    const std::vector<double>& shutterOffsets() const;
+
+    /// Hash of the graph name, its output name, its shutter offsets and its
+    /// inputs, including the content of the input meshes read from the input
+    /// scene.
+    size_t inputsHash() const;
+
     const Inputs& inputs() const;
 
-    Output& output();
+    /// Resolves the inputs of the given ports, so that they are found by
+    /// port index with portInput() during the executions. The resolution is
+    /// kept until the inputs or the ports change.
+    void bindPorts(const std::vector<std::string>& portNames);
+
+    /// The input of the port at the given index of the bound ports, nullptr
+    /// if the port has no input.
+    const PXR_NS::VtValue* portInput(size_t portIndex) const;
+
+    /// The Bifrost mesh converted from the mesh at the given path of the
+    /// input scene, or nullptr if there is no mesh at this path. The mesh
+    /// and its hash are cached until the prim is dirtied, so that executions
+    /// with unchanged input meshes do not convert them again.
+    Amino::Ptr<Bifrost::Object> inputMesh(const PXR_NS::SdfPath& path) const;
+
+    /// Converts all the input meshes, see inputMesh(), so that the
+    /// executions only read the converted meshes and never access the input
+    /// scene. To be called before executing the graph on another thread than
+    /// the one updating the input scene.
+    void convertInputMeshes() const;
+
+    /// Discards the cached data of the given prims of the input scene, see
+    /// inputMesh().
+    void dirtyInputPrims(const PXR_NS::SdfPathVector& paths);
+
+    /// The output name, and the output objects of the last successful
+    /// execution.
+    const Output& output() const;
+
+    /// \name Output collection
+    /// The objects of an execution are collected in a back buffer, so that
+    /// the objects of the previous execution stay readable in output() until
+    /// the execution is committed. The buffers are swapped by commitOutput(),
+    /// so their capacity is reused across the executions.
+    /// \{
+    /// Clears the back buffer and reserves the object count of the previous
+    /// execution.
+    void beginOutput();
+    /// Adds an output object of the running execution to the back buffer.
+    void addOutput(Amino::Ptr<Bifrost::Object> object);
+    /// Makes the objects of the back buffer the output.
+    void commitOutput();
+    /// \}
 
 public:
     /// Disabled
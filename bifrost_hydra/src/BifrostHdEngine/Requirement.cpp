@@ -25,10 +25,16 @@ Requirement::Requirement(const Amino::String&                  name,
                          BifrostGraph::Executor::PortDirection direction,
                          const Amino::Type&                    type,
                          BifrostGraph::Executor::PortClass     portClass,
-                         Amino::Any                            defaultValue)
+                         Amino::Any                            defaultValue,
+                         size_t                                portIndex)
     : BifrostGraph::Executor::JobPreview::Requirement(
           name, direction, type, portClass),
-      m_defaultVal(std::move(defaultValue)) {}
+      m_defaultVal(std::move(defaultValue)),
+      m_portIndex(portIndex) {
+    if (m_portIndex != kNoPortIndex) {
+        m_converter = ValueTranslationData::findInputConverter(type);
+    }
+}
 
 void Requirement::translate(
     BifrostBoardRuntime const*                              runtime,
@@ -40,7 +46,7 @@ void Requirement::translate(
 
     ValueTranslationData valueTranslationData(
         *static_cast<JobTranslationData*>(translationData), m_defaultVal,
-        m_name.c_str());
+        m_name.c_str(), m_portIndex, m_converter);
 
     BifrostGraph::Executor::JobPreview::Requirement::translate(
         runtime, job, &valueTranslationData);
@@ -19,18 +19,28 @@
 
 #include <BifrostHydra/Engine/Export.h>
 
+#include <BifrostHydra/Engine/ValueTranslationData.h>
+
 #include <BifrostGraph/Executor/BifrostBoardRuntime.h>
 
+#include <limits>
+
 namespace BifrostHd {
 
 class BIFROST_HD_ENGINE_SHARED_DECL Requirement final
     : public BifrostGraph::Executor::JobPreview::Requirement {
 public:
+    /// The port index of the requirements of the output ports.
+    static constexpr size_t kNoPortIndex = std::numeric_limits<size_t>::max();
+
+    /// \param [in] portIndex The index of the input port in
+    ///            Container::inputPortNames(), or kNoPortIndex.
     Requirement(const Amino::String&                  name,
                 BifrostGraph::Executor::PortDirection direction,
                 const Amino::Type&                    type,
                 BifrostGraph::Executor::PortClass     portClass,
-                Amino::Any                            defaultValue);
+                Amino::Any                            defaultValue,
+                size_t                                portIndex = kNoPortIndex);
 
     ~Requirement() override = default;
 
@@ -50,6 +60,10 @@ public:
 
 private:
     Amino::Any m_defaultVal; ///< Default value to use if none is set in input
+    size_t     m_portIndex;
+    /// Resolved once from the port type, nullptr for the output ports and
+    /// the unsupported types.
+    ValueTranslationData::InputConverter m_converter = nullptr;
 };
 
 } // namespace BifrostHd
@@ -15,23 +15,30 @@
 //+
 
 #include <BifrostHydra/Engine/Runtime.h>
+
+#include <BifrostHydra/Engine/Container.h>
 #include <BifrostHydra/Engine/Workspace.h>
 
 namespace {
 std::unique_ptr<BifrostHd::Runtime> g_runtime;
+std::once_flag                      g_runtimeOnce;
 } // namespace
 
 namespace BifrostHd {
 
 Runtime::Runtime(Workspace& workspace) : BifrostBoardRuntime(workspace) {}
 
-Runtime::~Runtime() = default;
+Runtime::~Runtime() {
+    // The containers must be destroyed before the runtime they refer to.
+    m_containers.clear();
+}
 
 Runtime& Runtime::getInstance() {
-    if (!g_runtime) {
+    // Also called by the engines executing on worker threads.
+    std::call_once(g_runtimeOnce, []() {
         g_runtime = std::make_unique<Runtime>(Workspace::getInstance());
-        assert(g_runtime);
-    }
+    });
+    assert(g_runtime);
     return *g_runtime;
 }
 
@@ -40,4 +47,60 @@ void Runtime::reportMessage(Amino::MessageCategory /*category*/,
     static_cast<Workspace const&>(getWorkspace()).reportMessage(Amino::String("[Runtime] ") + message);
 }
 
+ContainerLease Runtime::acquireContainer(const std::string& compoundName) {
+    std::unique_ptr<Container> container;
+    if (!takePooledContainer(compoundName, container)) {
+        return nullptr;
+    }
+
+    if (!container) {
+        std::lock_guard<std::mutex> compileLock(m_compileMutex);
+        // Another engine may have compiled the compound, or failed to, while
+        // this one was waiting.
+        if (!takePooledContainer(compoundName, container)) {
+            return nullptr;
+        }
+        if (!container) {
+            container = std::make_unique<Container>(*this);
+            // Since for now we can't change the graph at runtime (no Bifrost
+            // Graph Editor "attached" to our runtime), the graph of a
+            // container is loaded and compiled just once.
+            if (!container->loadGraph(
+                    Amino::String{compoundName.c_str()},
+                    BifrostGraph::Executor::GraphContainerPreview::GraphMode::
+                        kLoadAsReference) ||
+                !container->updateJob()) {
+                std::lock_guard<std::mutex> lock(m_containersMutex);
+                m_failedCompounds.insert(compoundName);
+                return nullptr;
+            }
+        }
+    }
+
+    return ContainerLease{container.release(),
+                          [this, compoundName](Container* lent) {
+                              releaseContainer(compoundName, lent);
+                          }};
+}
+
+bool Runtime::takePooledContainer(const std::string&          compoundName,
+                                  std::unique_ptr<Container>& container) {
+    std::lock_guard<std::mutex> lock(m_containersMutex);
+    if (m_failedCompounds.count(compoundName) != 0) {
+        return false;
+    }
+    auto& containers = m_containers[compoundName];
+    if (!containers.empty()) {
+        container = std::move(containers.back());
+        containers.pop_back();
+    }
+    return true;
+}
+
+void Runtime::releaseContainer(const std::string& compoundName,
+                               Container*         container) {
+    std::lock_guard<std::mutex> lock(m_containersMutex);
+    m_containers[compoundName].emplace_back(container);
+}
+
 } // namespace BifrostHd
@@ -21,9 +21,22 @@
 
 #include <BifrostGraph/Executor/BifrostBoardRuntime.h>
 
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
 namespace BifrostHd {
+class Container;
 class Workspace;
 
+/// A container borrowed from the Runtime. It is given back to the Runtime
+/// when destroyed.
+using ContainerLease = std::unique_ptr<Container, std::function<void(Container*)>>;
+
 class BIFROST_HD_ENGINE_SHARED_DECL Runtime final : public BifrostBoardRuntime {
 public:
     static Runtime& getInstance();
@@ -34,6 +47,18 @@ public:
     void reportMessage(Amino::MessageCategory category,
                        Amino::String const&   message) const override;
 
+    /// Lends a container with the given compound loaded and its job
+    /// compiled. The containers are pooled by compound name, so that the
+    /// engines executing the same compound share the compiled jobs instead
+    /// of each loading and compiling it. A container is lent to one caller
+    /// at a time, a new one is compiled only if all the containers of the
+    /// compound are lent. The compounds are loaded and compiled one at a
+    /// time, only the pooled containers are lent concurrently.
+    /// \returns nullptr if the compound could not be loaded or compiled.
+    ///          The failure is remembered, so that a compound that fails is
+    ///          not loaded and compiled again at each execution.
+    ContainerLease acquireContainer(const std::string& compoundName);
+
 public:
     /// Disabled
     /// \{
@@ -42,6 +67,24 @@ public:
     Runtime& operator=(const Runtime&) = delete;
     Runtime& operator=(Runtime&&)      = delete;
     /// \}
+
+private:
+    /// Takes a container of the compound from the pool, if there is one.
+    /// \returns false if the compound failed to load or compile.
+    bool takePooledContainer(const std::string&          compoundName,
+                             std::unique_ptr<Container>& container);
+
+    void releaseContainer(const std::string& compoundName,
+                          Container*         container);
+
+    /// Serializes the loading and compilation of the graphs.
+    std::mutex m_compileMutex;
+    std::mutex m_containersMutex;
+    /// The containers that are not lent, by compound name.
+    std::unordered_map<std::string, std::vector<std::unique_ptr<Container>>>
+        m_containers;
+    /// The compounds that failed to load or compile.
+    std::unordered_set<std::string> m_failedCompounds;
 };
 
 } // namespace BifrostHd
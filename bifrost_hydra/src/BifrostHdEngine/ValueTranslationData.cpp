@@ -18,62 +18,166 @@
 
 #include <BifrostHydra/Engine/JobTranslationData.h>
 #include <BifrostHydra/Engine/Parameters.h>
-#include <BifrostHydra/Translators/GeometryFn.h>
 
 #include <Bifrost/Math/Types.h>
 #include <Bifrost/Object/Object.h>
 
+#include <pxr/base/tf/token.h>
 #include <pxr/usd/sdf/types.h>
-#include "pxr/imaging/hd/tokens.h"
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+
+namespace {
+using BifrostHd::Parameters;
+
+/// Converts a scalar input, casting it with the VtValue casts if it does
+/// not hold a UsdT.
+template <typename AminoT, typename UsdT = AminoT>
+bool convertScalar(const PXR_NS::VtValue& value,
+                   const Parameters& /*parameters*/,
+                   Amino::Any& result) {
+    if (value.IsHolding<UsdT>()) {
+        result = Amino::Any{static_cast<AminoT>(value.UncheckedGet<UsdT>())};
+        return true;
+    }
+    if (value.CanCast<UsdT>()) {
+        result = Amino::Any{static_cast<AminoT>(
+            PXR_NS::VtValue::Cast<UsdT>(value).UncheckedGet<UsdT>())};
+        return true;
+    }
+    return false;
+}
+
+bool convertString(const PXR_NS::VtValue& value,
+                   const Parameters& /*parameters*/,
+                   Amino::Any& result) {
+    if (value.IsHolding<std::string>()) {
+        result = Amino::Any{
+            Amino::String{value.UncheckedGet<std::string>().c_str()}};
+        return true;
+    }
+    if (value.IsHolding<PXR_NS::TfToken>()) {
+        result = Amino::Any{
+            Amino::String{value.UncheckedGet<PXR_NS::TfToken>().GetText()}};
+        return true;
+    }
+    return false;
+}
+
+bool convertFloat3(const PXR_NS::VtValue& value,
+                   const Parameters& /*parameters*/,
+                   Amino::Any& result) {
+    if (!value.CanCast<PXR_NS::GfVec3f>()) {
+        return false;
+    }
+    const auto gf3 = value.IsHolding<PXR_NS::GfVec3f>()
+                         ? value.UncheckedGet<PXR_NS::GfVec3f>()
+                         : PXR_NS::VtValue::Cast<PXR_NS::GfVec3f>(value)
+                               .UncheckedGet<PXR_NS::GfVec3f>();
+    result = Amino::Any{Bifrost::Math::float3{gf3[0], gf3[1], gf3[2]}};
+    return true;
+}
+
+bool convertObject(const PXR_NS::VtValue& value,
+                   const Parameters&      parameters,
+                   Amino::Any&            result) {
+    if (!value.IsHolding<PXR_NS::VtArray<PXR_NS::SdfPath>>()) {
+        return false;
+    }
+    const auto& paths = value.UncheckedGet<PXR_NS::VtArray<PXR_NS::SdfPath>>();
+    if (paths.size() != 1) {
+        return false;
+    }
+    // Converted once, until the input mesh is dirtied.
+    auto obj = parameters.inputMesh(paths[0]);
+    if (!obj) {
+        return false;
+    }
+    result = Amino::Any{obj};
+    return true;
+}
+
+/// Converts an array input with a single copy of its elements.
+template <typename AminoT, typename UsdT>
+bool convertArray(const PXR_NS::VtValue& value,
+                  const Parameters& /*parameters*/,
+                  Amino::Any& result) {
+    static_assert(sizeof(UsdT) == sizeof(AminoT) &&
+                      std::is_trivially_copyable<UsdT>::value &&
+                      std::is_trivially_copyable<AminoT>::value,
+                  "Amino and Vt array elements must be layout compatible");
+    if (!value.IsHolding<PXR_NS::VtArray<UsdT>>()) {
+        return false;
+    }
+    const auto& array = value.UncheckedGet<PXR_NS::VtArray<UsdT>>();
+    auto aminoArray = Amino::newMutablePtr<Amino::Array<AminoT>>(array.size());
+    if (!array.empty()) {
+        std::memcpy(static_cast<void*>(&(*aminoArray)[0]),
+                    static_cast<const void*>(array.cdata()),
+                    array.size() * sizeof(UsdT));
+    }
+    result = Amino::Any{aminoArray.toImmutable()};
+    return true;
+}
+
+} // namespace
 
 namespace BifrostHd {
 
+ValueTranslationData::InputConverter ValueTranslationData::findInputConverter(
+    const Amino::Type& type) {
+    // Keyed by the names returned by TypeTranslation::getSupportedTypeNames.
+    static const std::unordered_map<std::string, InputConverter> converters = {
+        {"bool", &convertScalar<bool>},
+        {"float", &convertScalar<float>},
+        {"double", &convertScalar<double>},
+        {"int", &convertScalar<int>},
+        {"uint", &convertScalar<unsigned int>},
+        {"long", &convertScalar<Amino::long_t, std::int64_t>},
+        {"ulong", &convertScalar<Amino::ulong_t, std::uint64_t>},
+        {"string", &convertString},
+        {"Math::float3", &convertFloat3},
+        {"Object", &convertObject},
+        {"array<bool>", &convertArray<bool, bool>},
+        {"array<float>", &convertArray<float, float>},
+        {"array<int>", &convertArray<int, int>},
+        {"array<Math::float3>",
+         &convertArray<Bifrost::Math::float3, PXR_NS::GfVec3f>},
+    };
+
+    auto found = converters.find(type.getFullyQualifiedName().c_str());
+    return found != converters.end() ? found->second : nullptr;
+}
+
 ValueTranslationData::ValueTranslationData(
     JobTranslationData& jobTranslationData,
     Amino::Any          defaultVal,
-    std::string         name)
+    std::string         name,
+    size_t              portIndex,
+    InputConverter      converter)
     : BifrostGraph::Executor::JobPreview::ValueData(),
       m_defaultVal(std::move(defaultVal)),
       m_jobTranslationData(jobTranslationData),
-      m_name(std::move(name)) {}
+      m_name(std::move(name)),
+      m_portIndex(portIndex),
+      m_converter(converter) {}
 
 ValueTranslationData::~ValueTranslationData() = default;
 
 Amino::Any ValueTranslationData::getInput(Amino::Type const& /*type*/) const {
-    const auto& inputs     = m_jobTranslationData.getParameters().inputs();
-    const auto& inputScene = m_jobTranslationData.getParameters().inputScene();
-
-    auto search = inputs.find(m_name);
-    if (search != inputs.end()) {
-        const auto& vtValue = search->second;
-
-        if (vtValue.IsHolding<bool>()) {
-            return Amino::Any{vtValue.UncheckedGet<bool>()};
-        } else if (vtValue.IsHolding<unsigned int>()) {
-            return Amino::Any{vtValue.UncheckedGet<unsigned int>()};
-        } else if (vtValue.IsHolding<int>()) {
-            return Amino::Any{vtValue.UncheckedGet<int>()};
-        } else if (vtValue.IsHolding<float>()) {
-            return Amino::Any{vtValue.UncheckedGet<float>()};
-        } else if (vtValue.IsHolding<PXR_NS::GfVec3f>()) {
-            auto                  gf3 = vtValue.UncheckedGet<PXR_NS::GfVec3f>();
-            Bifrost::Math::float3 flt3{gf3[0], gf3[1], gf3[2]};
-            return Amino::Any{flt3};
-        } else if (vtValue.IsHolding<std::int64_t>()) {
-            return Amino::Any{static_cast<Amino::long_t>(
-                vtValue.UncheckedGet<std::int64_t>())};
-        } else if (vtValue.IsHolding<std::string>()) {
-            return Amino::Any{Amino::String{vtValue.UncheckedGet<std::string>().c_str()}};
-        } else if (vtValue.IsHolding<PXR_NS::VtArray<PXR_NS::SdfPath>>()) {
-            auto paths = vtValue.UncheckedGet<PXR_NS::VtArray<PXR_NS::SdfPath>>();
-            if (paths.size() == 1) {
-                auto sourceMeshPrim = inputScene->GetPrim(paths[0]);
-                if (sourceMeshPrim.primType == PXR_NS::HdPrimTypeTokens->mesh) {
-                    auto obj = BifrostHd::CreateBifrostMesh(sourceMeshPrim);
-                    if (obj) {
-                        return Amino::Any{obj};
-                    }
-                }
+    // The converter was resolved from the port type when the requirements
+    // were populated, and the input is found by port index, so that no
+    // type or name lookup is done per execution.
+    if (m_converter) {
+        const auto& parameters = m_jobTranslationData.getParameters();
+        if (const auto* vtValue = parameters.portInput(m_portIndex)) {
+            Amino::Any result;
+            if (m_converter(*vtValue, parameters, result)) {
+                return result;
             }
         }
     }
@@ -81,21 +185,21 @@ Amino::Any ValueTranslationData::getInput(Amino::Type const& /*type*/) const {
 }
 
 bool ValueTranslationData::setOutput(const Amino::Any& value) {
-    auto& output = m_jobTranslationData.getParameters().output();
-    if (output.first == m_name) {
+    auto& parameters = m_jobTranslationData.getParameters();
+    if (parameters.output().first == m_name) {
         if (value.type() == Amino::getTypeId<Amino::Ptr<Amino::Array<Amino::Ptr<Bifrost::Object>>>>()) {
             auto objectArray = Amino::any_cast<Amino::Ptr<Amino::Array<Amino::Ptr<Bifrost::Object>>>>(value);
             assert(objectArray != nullptr);
             if (objectArray != nullptr && !objectArray->empty()) {
                 for (auto& object : *objectArray) {
-                    output.second.push_back(object);
+                    parameters.addOutput(object);
                 }
                 return true;
             }
          } else if (value.type() == Amino::getTypeId<Amino::Ptr<Bifrost::Object>>()) {
             auto object = Amino::any_cast<Amino::Ptr<Bifrost::Object>>(value);
             if (object) {
-                output.second.push_back(object);
+                parameters.addOutput(std::move(object));
                 return true;
             }
         }
@@ -21,16 +21,31 @@
 
 #include <BifrostGraph/Executor/JobPreview.h>
 
+#include <pxr/base/vt/value.h>
+
 namespace BifrostHd {
 
 class JobTranslationData;
+class Parameters;
 
 class BIFROST_HD_ENGINE_SHARED_DECL ValueTranslationData final
     : public BifrostGraph::Executor::JobPreview::ValueData {
 public:
+    /// Converts the value of an input to the Amino type of its port.
+    /// \returns false if the value can't be converted to this type.
+    using InputConverter = bool (*)(const PXR_NS::VtValue& value,
+                                    const Parameters&      parameters,
+                                    Amino::Any&            result);
+
+    /// The converter of the inputs of the ports of the given type, or
+    /// nullptr if the type is not supported.
+    static InputConverter findInputConverter(const Amino::Type& type);
+
     ValueTranslationData(JobTranslationData& jobTranslationData,
                          Amino::Any          defaultVal,
-                         std::string         name);
+                         std::string         name,
+                         size_t              portIndex = 0,
+                         InputConverter      converter = nullptr);
     ~ValueTranslationData() override;
 
     Amino::Any getInput(Amino::Type const& type) const;
@@ -51,6 +66,8 @@ private:
     Amino::Any          m_defaultVal;
     JobTranslationData& m_jobTranslationData;
     std::string         m_name;
+    size_t              m_portIndex;
+    InputConverter      m_converter;
 };
 
 } // namespace BifrostHd
@@ -22,8 +22,11 @@
 #include <AminoConfig.h>
 #include <AminoStringList.h>
 
+#include <mutex>
+
 namespace {
 std::unique_ptr<BifrostHd::Workspace> g_workspace;
+std::once_flag                        g_workspaceOnce;
 } // namespace
 
 namespace BifrostHd {
@@ -47,10 +50,11 @@ Workspace::Workspace(const Amino::String& name) : WorkspacePreview(name) {
 Workspace::~Workspace() = default;
 
 Workspace& Workspace::getInstance() {
-    if (!g_workspace) {
+    // Also called by the engines executing on worker threads.
+    std::call_once(g_workspaceOnce, []() {
         g_workspace = std::make_unique<Workspace>("BifrostHd");
-        assert(g_workspace);
-    }
+    });
+    assert(g_workspace);
     return *g_workspace;
 }
 
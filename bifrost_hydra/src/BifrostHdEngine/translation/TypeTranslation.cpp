@@ -47,6 +47,10 @@ void TypeTranslation::getSupportedTypeNames(
     out_names.push_back("string");
     out_names.push_back("Math::float3");
     out_names.push_back("Object");
+    out_names.push_back("array<bool>");
+    out_names.push_back("array<float>");
+    out_names.push_back("array<int>");
+    out_names.push_back("array<Math::float3>");
     // for graphs using time nodes
     out_names.push_back("Simulation::Time");
 }
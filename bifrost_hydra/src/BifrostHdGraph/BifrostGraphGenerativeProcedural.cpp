@@ -19,9 +19,15 @@
 #include <BifrostHydra/Translators/GeometryFn.h>
 #include <BifrostHydra/Translators/Instances.h>
 #include <BifrostHydra/Translators/Mesh.h>
+#include <BifrostHydra/Translators/Points.h>
 #include <BifrostHydra/Translators/Strands.h>
 
+#include <pxr/base/work/loops.h>
+#include <pxr/imaging/hd/meshSchema.h>
+#include <pxr/imaging/hd/primvarsSchema.h>
+
 #include <iostream>
+#include <vector>
 
 PXR_NAMESPACE_USING_DIRECTIVE
 
@@ -29,79 +35,326 @@ BifrostGraphGenerativeProcedural::BifrostGraphGenerativeProcedural(
     const SdfPath& proceduralPrimPath)
     : HdGpGenerativeProcedural(proceduralPrimPath) {}
 
+BifrostGraphGenerativeProcedural::~BifrostGraphGenerativeProcedural() {
+    // The running execution uses the engine, it must be over first.
+    m_cancelExecution = true;
+    m_dispatcher.Wait();
+}
+
 HdGpGenerativeProcedural::DependencyMap
 BifrostGraphGenerativeProcedural::UpdateDependencies(
-    const HdSceneIndexBaseRefPtr& /*inputScene*/) {
+    const HdSceneIndexBaseRefPtr& inputScene) {
     HdGpGenerativeProcedural::DependencyMap result;
+    const auto graphPath = _GetProceduralPrimPath();
+
+    // The graph name and inputs are primvars of the procedural prim.
+    result[graphPath].insert(HdPrimvarsSchema::GetDefaultLocator());
+
+    // The meshes given as inputs are read from the input scene (see
+    // ValueTranslationData::getInput).
+    auto primvars = HdPrimvarsSchema::GetFromParent(
+        inputScene->GetPrim(graphPath).dataSource);
+    for (const auto& name : primvars.GetPrimvarNames()) {
+        auto dataSource = primvars.GetPrimvar(name).GetPrimvarValue();
+        if (!dataSource) continue;
+        auto value = dataSource->GetValue(0.0f);
+        if (!value.IsHolding<VtArray<SdfPath>>()) continue;
+        for (const auto& path : value.UncheckedGet<VtArray<SdfPath>>()) {
+            auto& locators = result[path];
+            locators.insert(HdMeshSchema::GetDefaultLocator());
+            locators.insert(HdPrimvarsSchema::GetDefaultLocator());
+        }
+    }
 
     return result;
 }
 
 // Cooks/Recooks and returns the current state of child paths and their
-// types. At the moment we create a new Bifrost Graph when any of the parameters
-// on the procedural are changed.
+// types. The Bifrost Graph is executed again only when its inputs, or the
+// input meshes it depends on, changed.
 HdGpGenerativeProcedural::ChildPrimTypeMap
 BifrostGraphGenerativeProcedural::Update(
     const HdSceneIndexBaseRefPtr& inputScene,
+    const ChildPrimTypeMap& previousResult,
+    const DependencyMap& dirtiedDependencies,
+    HdSceneIndexObserver::DirtiedPrimEntries* outputDirtiedPrims) {
+    auto graphPath = _GetProceduralPrimPath();
+
+    // Only the dirtied primvars of the procedural prim are read again.
+    const auto graphDirtied = dirtiedDependencies.find(graphPath);
+    const HdDataSourceLocatorSet* graphDirtiedLocators =
+        graphDirtied != dirtiedDependencies.end() ? &graphDirtied->second
+                                                  : nullptr;
+    SdfPathVector dirtiedInputPrims;
+    for (const auto& entry : dirtiedDependencies) {
+        if (entry.first != graphPath) {
+            dirtiedInputPrims.push_back(entry.first);
+        }
+    }
+
+    if (m_executing) {
+        // The engine is busy: the running execution is cancelled, and the
+        // graph is updated again when it is over (see AsyncUpdate).
+        m_cancelExecution = true;
+        m_pendingScene    = inputScene;
+        m_pendingDirtiedInputPrims.insert(m_pendingDirtiedInputPrims.end(),
+                                          dirtiedInputPrims.begin(),
+                                          dirtiedInputPrims.end());
+        return previousResult;
+    }
+
+    if (!updateInputs(inputScene, graphDirtiedLocators, dirtiedInputPrims)) {
+        return previousResult;
+    }
+
+    // Going back to a frame already evaluated with the same inputs (e.g.
+    // when scrubbing) reuses the cached translators instead of executing
+    // the graph again.
+    const OutputCacheKey key{m_engine.frame(), m_engine.inputsHash()};
+    auto                 output = findCachedOutput(key);
+    if (!output) {
+        if (m_async) {
+            // The children of the previous execution are served until this
+            // one is over.
+            startExecution(key);
+            return previousResult;
+        }
+        output = executeGraph(key, nullptr);
+        if (output) {
+            addCachedOutput(key, output);
+        } else {
+            output = std::make_shared<const CachedOutput>();
+        }
+    }
+
+    applyOutput(*output, outputDirtiedPrims);
+    return output->childPrimTypes;
+}
+
+#if PXR_VERSION >= 2308
+bool BifrostGraphGenerativeProcedural::AsyncBegin(bool asyncEnabled) {
+    m_async = asyncEnabled;
+    return m_async;
+}
+
+HdGpGenerativeProcedural::AsyncState
+BifrostGraphGenerativeProcedural::AsyncUpdate(
     const ChildPrimTypeMap& /*previousResult*/,
-    const DependencyMap& /*dirtiedDependencies*/,
+    ChildPrimTypeMap*                         outputPrimTypes,
     HdSceneIndexObserver::DirtiedPrimEntries* outputDirtiedPrims) {
-    ChildPrimTypeMap result;
-    auto             graphPath = _GetProceduralPrimPath();
+    // The procedural keeps being polled, since any later Update() can start
+    // a new execution.
+    if (!m_executing || !m_executionDone) {
+        return Continuing;
+    }
+
+    // The task is over, waiting only collects it.
+    m_dispatcher.Wait();
+    m_executing = false;
+    auto output = std::move(m_executionOutput);
+    if (!m_cancelExecution.exchange(false)) {
+        if (output) {
+            addCachedOutput(m_executionKey, output);
+        } else {
+            output = std::make_shared<const CachedOutput>();
+        }
+        applyOutput(*output, outputDirtiedPrims);
+        *outputPrimTypes = output->childPrimTypes;
+        return ContinuingWithNewChanges;
+    }
+
+    // The execution was cancelled by an Update() received while it was
+    // running. The primvars dirtied since were not recorded, so they are all
+    // read again.
+    auto inputScene        = std::move(m_pendingScene);
+    auto dirtiedInputPrims = std::move(m_pendingDirtiedInputPrims);
+    m_pendingScene         = nullptr;
+    m_pendingDirtiedInputPrims.clear();
+    updateInputs(inputScene, nullptr, dirtiedInputPrims);
+
+    // An execution cancelled after its last job still has the output of its
+    // key. When the update did not change the key, e.g. when it dirtied data
+    // the graph does not read, that output is served instead of executing
+    // the graph again, so that frequent updates do not starve it.
+    if (output) {
+        addCachedOutput(m_executionKey, output);
+    }
+    const OutputCacheKey key{m_engine.frame(), m_engine.inputsHash()};
+    auto cached = output && key == m_executionKey ? std::move(output)
+                                                  : findCachedOutput(key);
+    if (cached) {
+        applyOutput(*cached, outputDirtiedPrims);
+        *outputPrimTypes = cached->childPrimTypes;
+        return ContinuingWithNewChanges;
+    }
+    startExecution(key);
+    return Continuing;
+}
+#endif
+
+bool BifrostGraphGenerativeProcedural::updateInputs(
+    const HdSceneIndexBaseRefPtr& inputScene,
+    const HdDataSourceLocatorSet* graphDirtiedLocators,
+    const SdfPathVector&          dirtiedInputPrims) {
     m_engine.setInputScene(inputScene);
-    m_engine.setInputs(inputScene->GetPrim(graphPath));
+    const bool inputsChanged = m_engine.setInputs(
+        inputScene->GetPrim(_GetProceduralPrimPath()),
+        m_executed ? graphDirtiedLocators : nullptr);
+
+    m_engine.dirtyInputPrims(dirtiedInputPrims);
+    if (m_executed && !inputsChanged && dirtiedInputPrims.empty()) {
+        return false;
+    }
+    m_executed = true;
+    return true;
+}
 
-    if (m_engine.execute(/*frame*/ 0.0) == Amino::Job::State::kSuccess) {
-        const auto& output      = m_engine.output();
-        const auto& objectArray = output.second;
+std::shared_ptr<const BifrostGraphGenerativeProcedural::CachedOutput>
+BifrostGraphGenerativeProcedural::executeGraph(
+    const OutputCacheKey& key, const std::atomic<bool>* cancelled) {
+    // The graph is executed at the requested shutter offsets first, so
+    // that the output of the engine is the one of the frame afterwards.
+    // Failing motion samples only disable the motion blur.
+    // The Bifrost jobs can't be interrupted, but a cancelled execution
+    // stops between them, and its output is not translated.
+    BifrostHd::MotionOutputs motionOutputs;
+    m_engine.executeMotionSamples(key.first, motionOutputs);
+    if (cancelled && *cancelled) {
+        return nullptr;
+    }
+    if (m_engine.execute(key.first) != Amino::Job::State::kSuccess) {
+        return nullptr;
+    }
+    if (cancelled && *cancelled) {
+        return nullptr;
+    }
 
-        for (size_t i = 0; i < objectArray.size(); ++i) {
-            // We need to cache if the geo is an instance as it is
-            // costly to re-do it for each path in the sub-loop later on
+    auto output = std::make_shared<CachedOutput>();
+    translateOutput(m_engine.output().second, motionOutputs, *output);
+    return output;
+}
 
-            std::shared_ptr<BifrostHd::Geometry> geo;
-            const auto&                          obj = *(objectArray[i]);
+void BifrostGraphGenerativeProcedural::applyOutput(
+    const CachedOutput&                       output,
+    HdSceneIndexObserver::DirtiedPrimEntries* outputDirtiedPrims) {
+    // Only the data that changed since the previous execution is dirtied, so
+    // that render delegates do not rebuild the topology of a geometry whose
+    // points only moved. New children are added by the caller.
+    for (const auto& path : output.childPaths) {
+        const auto& translator = output.translators.at(path);
+        const auto  previous   = m_geomTranslators.find(path);
+        if (previous == m_geomTranslators.end() ||
+            previous->second == translator) {
+            continue;
+        }
+        auto locators = translator->getDirtiedLocators(
+            path.MakeRelativePath(_GetProceduralPrimPath()), *previous->second);
+        if (!locators.IsEmpty()) {
+            outputDirtiedPrims->emplace_back(path, std::move(locators));
+        }
+    }
+    m_geomTranslators = output.translators;
+}
 
-            auto geoType = BifrostHd::GetGeoType(obj);
+void BifrostGraphGenerativeProcedural::startExecution(
+    const OutputCacheKey& key) {
+    // The input meshes are converted here, on the thread updating the
+    // procedural, since the input scene must not be read by the task.
+    m_engine.convertInputMeshes();
 
-            switch (geoType) {
+    m_executionKey    = key;
+    m_cancelExecution = false;
+    m_executionDone   = false;
+    m_executing       = true;
+    m_dispatcher.Run([this, key]() {
+        m_executionOutput = executeGraph(key, &m_cancelExecution);
+        m_executionDone   = true;
+    });
+}
+
+void BifrostGraphGenerativeProcedural::translateOutput(
+    const Amino::Array<Amino::Ptr<Bifrost::Object>>& objectArray,
+    const BifrostHd::MotionOutputs&                  motionOutputs,
+    CachedOutput&                                    output) const {
+    // The translators only read the immutable Bifrost objects, so they are
+    // created in parallel. They are then merged in the order of the objects,
+    // so that the children do not depend on the scheduling of the tasks.
+    std::vector<std::shared_ptr<BifrostHd::Geometry>> geos(objectArray.size());
+    WorkParallelForN(objectArray.size(), [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            const auto& obj = objectArray[i];
+
+            // The objects at the same index in the outputs at the other
+            // shutter offsets.
+            BifrostHd::MotionSamples motionSamples;
+            for (const auto& motionOutput : motionOutputs) {
+                if (i < motionOutput.second.size()) {
+                    motionSamples.push_back(
+                        {static_cast<float>(motionOutput.first),
+                         motionOutput.second[i]});
+                }
+            }
+
+            switch (BifrostHd::GetGeoType(*obj)) {
                 case BifrostHdGeoTypes::Empty: break;
                 case BifrostHdGeoTypes::Mesh:
-                    geo = std::make_shared<BifrostHd::Mesh>(obj, i);
+                    geos[i] = std::make_shared<BifrostHd::Mesh>(obj, i,
+                                                                motionSamples);
                     break;
                 case BifrostHdGeoTypes::Strands:
-                    geo = std::make_shared<BifrostHd::Strands>(obj, i);
+                    geos[i] = std::make_shared<BifrostHd::Strands>(
+                        obj, i, motionSamples);
+                    break;
+                case BifrostHdGeoTypes::PointCloud:
+                    geos[i] = std::make_shared<BifrostHd::Points>(
+                        obj, i, motionSamples);
                     break;
-                case BifrostHdGeoTypes::PointCloud: break;
                 case BifrostHdGeoTypes::Instances:
-                    geo = std::make_shared<BifrostHd::Instances>(obj);
+                    geos[i] = std::make_shared<BifrostHd::Instances>(
+                        obj, _GetProceduralPrimPath(), i, motionSamples);
                     break;
             }
+        }
+    });
+
+    auto graphPath = _GetProceduralPrimPath();
+    for (size_t i = 0; i < geos.size(); ++i) {
+        const auto& geo = geos[i];
+        if (geo) {
+            // The children names are paths relative to the procedural prim,
+            // e.g. the prototypes are children of their instancer.
+            for (const auto& child : geo->getChildren()) {
+                const auto path = graphPath.AppendPath(child.first);
 
-            if (geo) {
-                auto   path = graphPath;
-                size_t j    = 0;
-                for (const auto& child : geo->getChildren()) {
-                    // TODO(laforgg): Instances support is not working yet
-                    if (geoType == BifrostHdGeoTypes::Instances && j > 0) {
-                        path = path.AppendChild(TfToken{"prototypes"});
-                        path = path.AppendChild(TfToken{"mesh"});
-                    } else {
-                        const auto& childName = child.first;
-                        path = path.AppendChild(childName.GetToken());
-                    }
-
-                    result[path] = geo->getSceneIndexPrimTypeName();
-                    outputDirtiedPrims->emplace_back(path,
-                                                     geo->TopologyLocator());
-                    m_geomTranslators[path] = geo;
-                    j++;
+                output.childPrimTypes[path] = child.second.primType;
+                auto& translator            = output.translators[path];
+                if (!translator) {
+                    output.childPaths.push_back(path);
                 }
+                translator = geo;
             }
         }
     }
+}
 
-    return result;
+std::shared_ptr<const BifrostGraphGenerativeProcedural::CachedOutput>
+BifrostGraphGenerativeProcedural::findCachedOutput(const OutputCacheKey& key) {
+    for (auto it = m_outputCache.begin(); it != m_outputCache.end(); ++it) {
+        if (it->first == key) {
+            // Most recently used outputs are kept at the front.
+            m_outputCache.splice(m_outputCache.begin(), m_outputCache, it);
+            return m_outputCache.front().second;
+        }
+    }
+    return nullptr;
+}
+
+void BifrostGraphGenerativeProcedural::addCachedOutput(
+    const OutputCacheKey& key, std::shared_ptr<const CachedOutput> output) {
+    m_outputCache.emplace_front(key, std::move(output));
+    if (m_outputCache.size() > kMaxCachedOutputs) {
+        m_outputCache.pop_back();
+    }
 }
 
 HdSceneIndexPrim BifrostGraphGenerativeProcedural::GetChildPrim(
@@ -116,8 +369,8 @@ HdSceneIndexPrim BifrostGraphGenerativeProcedural::GetChildPrim(
     auto geo = searchGeo->second;
     if (geo) {
         const auto& pathToPrim = geo->getChildren();
-        const auto  search =
-            pathToPrim.find(PXR_NS::SdfPath{childPrimPath.GetNameToken()});
+        const auto  search = pathToPrim.find(
+            childPrimPath.MakeRelativePath(_GetProceduralPrimPath()));
         if (search != pathToPrim.end()) {
             result = search->second;
         }
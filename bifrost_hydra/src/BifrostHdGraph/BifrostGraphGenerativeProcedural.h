@@ -17,20 +17,28 @@
 #ifndef BIFROST_HD_GRAPH_PROCEDURAL_H
 #define BIFROST_HD_GRAPH_PROCEDURAL_H
 
+#include <pxr/base/work/dispatcher.h>
 #include <pxr/imaging/hdGp/generativeProcedural.h>
 
 #include <BifrostHydra/Engine/Engine.h>
 #include <BifrostHydra/Translators/Geometry.h>
 
+#include <atomic>
+#include <list>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+
 PXR_NAMESPACE_OPEN_SCOPE
 
 
 class BifrostGraphGenerativeProcedural : public HdGpGenerativeProcedural {
 public:
     explicit BifrostGraphGenerativeProcedural(const SdfPath& proceduralPrimPath);
+    ~BifrostGraphGenerativeProcedural() override;
 
     DependencyMap UpdateDependencies(
-        const HdSceneIndexBaseRefPtr& /*inputScene*/) override;
+        const HdSceneIndexBaseRefPtr& inputScene) override;
 
     HdGpGenerativeProcedural::ChildPrimTypeMap Update(
         const HdSceneIndexBaseRefPtr&                     inputScene,
@@ -41,11 +49,94 @@ public:
     HdSceneIndexPrim GetChildPrim(const HdSceneIndexBaseRefPtr& inputScene,
                                   const SdfPath& childPrimPath) override;
 
+#if PXR_VERSION >= 2308
+    /// When the application allows it, the graph is executed by a task of
+    /// the work pool: Update() starts the execution and keeps serving the children
+    /// of the previous one, and AsyncUpdate() serves the new children once
+    /// the execution is done.
+    bool AsyncBegin(bool asyncEnabled) override;
+
+    AsyncState AsyncUpdate(
+        const ChildPrimTypeMap&                   previousResult,
+        ChildPrimTypeMap*                         outputPrimTypes,
+        HdSceneIndexObserver::DirtiedPrimEntries* outputDirtiedPrims) override;
+#endif
+
 private:
     using BifrostTranslatorsMap = std::unordered_map<SdfPath, std::shared_ptr<BifrostHd::Geometry>, TfHash>;
 
+    /// The children created from the output of one graph execution.
+    struct CachedOutput {
+        ChildPrimTypeMap      childPrimTypes;
+        BifrostTranslatorsMap translators;
+        /// The child paths, in the order of the graph output objects.
+        SdfPathVector         childPaths;
+    };
+
+    /// The frame and the hash of the inputs of a graph execution.
+    using OutputCacheKey = std::pair<double, size_t>;
+
+    /// Maximum number of graph executions kept in the output cache.
+    static constexpr size_t kMaxCachedOutputs = 32;
+
+    /// Reads the inputs of the graph and discards the conversions of the
+    /// dirtied input prims.
+    /// \returns true if the graph must be executed again.
+    bool updateInputs(const HdSceneIndexBaseRefPtr& inputScene,
+                      const HdDataSourceLocatorSet* graphDirtiedLocators,
+                      const SdfPathVector&          dirtiedInputPrims);
+
+    /// Executes the graph at the frame of the key, with its motion samples,
+    /// and translates its output.
+    /// \returns nullptr if the execution failed or was cancelled.
+    std::shared_ptr<const CachedOutput> executeGraph(
+        const OutputCacheKey& key, const std::atomic<bool>* cancelled);
+
+    /// Serves the children of the given output, dirtying the data of the
+    /// children that changed since the previous output.
+    void applyOutput(const CachedOutput&                       output,
+                     HdSceneIndexObserver::DirtiedPrimEntries* outputDirtiedPrims);
+
+    void startExecution(const OutputCacheKey& key);
+
+    void translateOutput(
+        const Amino::Array<Amino::Ptr<Bifrost::Object>>& objectArray,
+        const BifrostHd::MotionOutputs&                  motionOutputs,
+        CachedOutput&                                    output) const;
+
+    std::shared_ptr<const CachedOutput> findCachedOutput(
+        const OutputCacheKey& key);
+    void addCachedOutput(const OutputCacheKey&               key,
+                         std::shared_ptr<const CachedOutput> output);
+
     BifrostHd::Engine                    m_engine;
     BifrostTranslatorsMap                m_geomTranslators; 
+    bool                                 m_executed = false;
+
+    /// Least recently used cache of the graph executions, most recent first.
+    std::list<std::pair<OutputCacheKey, std::shared_ptr<const CachedOutput>>>
+        m_outputCache;
+
+    /// \name Asynchronous execution
+    /// While an execution runs, m_engine is only used by the task running
+    /// it, which does not access the input scene.
+    /// \{
+    bool           m_async = false;
+    /// Runs the executions on the work pool.
+    WorkDispatcher m_dispatcher;
+    /// Set when an execution is started, until its output is collected.
+    bool           m_executing = false;
+    /// Set by the task once m_executionOutput is written.
+    std::atomic<bool>                   m_executionDone{false};
+    std::shared_ptr<const CachedOutput> m_executionOutput;
+    OutputCacheKey                      m_executionKey;
+    /// Set when an update is received during the execution, so its output
+    /// is discarded.
+    std::atomic<bool>      m_cancelExecution{false};
+    /// The update received during the execution, done once it is over.
+    HdSceneIndexBaseRefPtr m_pendingScene;
+    SdfPathVector          m_pendingDirtiedInputPrims;
+    /// \}
 };
 
 PXR_NAMESPACE_CLOSE_SCOPE
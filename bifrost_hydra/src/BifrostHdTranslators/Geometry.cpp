@@ -16,10 +16,58 @@
 
 #include <BifrostHydra/Translators/Geometry.h>
 
+#include <algorithm>
+
 namespace BifrostHd {
 
+bool ContentHash::isSame(const ContentHash& other) const {
+    if (locator != other.locator || key != other.key ||
+        arrays.size() != other.arrays.size()) {
+        return false;
+    }
+    // The arrays are immutable, the same arrays have the same content.
+    if (arrays == other.arrays) {
+        return true;
+    }
+    return hashArrays && other.hashArrays &&
+           hashArrays() == other.hashArrays();
+}
+
 Geometry::Geometry() = default;
 
 Geometry::~Geometry() = default;
 
+PXR_NS::HdDataSourceLocatorSet Geometry::getDirtiedLocators(
+    const PXR_NS::SdfPath& childName, const Geometry& previous) const {
+    const auto hashes         = m_content_hashes.find(childName);
+    const auto previousHashes = previous.m_content_hashes.find(childName);
+    if (hashes == m_content_hashes.end() ||
+        previousHashes == previous.m_content_hashes.end()) {
+        return PXR_NS::HdDataSourceLocatorSet{
+            PXR_NS::HdDataSourceLocator::EmptyLocator()};
+    }
+
+    PXR_NS::HdDataSourceLocatorSet result;
+    for (const auto& hash : hashes->second) {
+        auto isSame = [&hash](const auto& previousHash) {
+            return hash.isSame(previousHash);
+        };
+        if (std::none_of(previousHashes->second.begin(),
+                         previousHashes->second.end(), isSame)) {
+            result.insert(hash.locator);
+        }
+    }
+    // The data that is not there anymore.
+    for (const auto& previousHash : previousHashes->second) {
+        auto hasLocator = [&previousHash](const auto& hash) {
+            return hash.locator == previousHash.locator;
+        };
+        if (std::none_of(hashes->second.begin(), hashes->second.end(),
+                         hasLocator)) {
+            result.insert(previousHash.locator);
+        }
+    }
+    return result;
+}
+
 } // namespace BifrostHd
@@ -19,14 +19,49 @@
 
 #include <BifrostHydra/Translators/Export.h>
 
+#include <Bifrost/Object/Object.h>
+
 #include <pxr/base/tf/denseHashMap.h>
 #include <pxr/imaging/hd/sceneIndex.h>
 #include <pxr/imaging/hd/dataSource.h>
+#include <pxr/imaging/hd/dataSourceLocator.h>
+
+#include <functional>
+#include <utility>
+#include <vector>
 
 namespace BifrostHd {
 
 using ChildPrimMap = PXR_NS::TfDenseHashMap<PXR_NS::SdfPath, PXR_NS::HdSceneIndexPrim, PXR_NS::TfHash>;
 
+/// A Bifrost object evaluated at a shutter offset, in frames, from the frame
+/// of the object being translated. Used to motion blur the translated prims.
+struct MotionSample {
+    float                       shutterOffset = 0.0f;
+    Amino::Ptr<Bifrost::Object> object;
+};
+using MotionSamples = std::vector<MotionSample>;
+
+/// The data of a translated prim at the locator of a data source, identified
+/// by the immutable Amino arrays it is read from. The content of the arrays
+/// is only hashed when two translations read it from different arrays.
+struct ContentHash {
+    PXR_NS::HdDataSourceLocator locator;
+    /// Hash of the values the data depends on other than the arrays.
+    size_t key = 0;
+    /// The addresses of the arrays, null for the missing ones.
+    std::vector<const void*> arrays;
+    /// Hashes the content of the arrays, which it holds so that their
+    /// addresses are not reused while this hash exists.
+    std::function<size_t()> hashArrays;
+
+    /// Whether the data is the same, comparing the arrays by address first.
+    bool isSame(const ContentHash& other) const;
+};
+using ContentHashes = std::vector<ContentHash>;
+using ChildContentHashMap =
+    PXR_NS::TfDenseHashMap<PXR_NS::SdfPath, ContentHashes, PXR_NS::TfHash>;
+
 class BIFROST_HD_TRANSLATORS_SHARED_DECL Geometry {
 public:
     explicit Geometry();
@@ -39,6 +74,15 @@ public:
 
     virtual const ChildPrimMap& getChildren() const = 0;
 
+    /// Returns the locators of the data of a child that changed since the
+    /// previous translation of the same geometry, so that render delegates
+    /// only update what changed. If the content of the child is unknown to
+    /// either translation, the whole child is dirtied.
+    /// \param [in] childName The name of the child, as in getChildren().
+    /// \param [in] previous The previous translation of the geometry.
+    PXR_NS::HdDataSourceLocatorSet getDirtiedLocators(
+        const PXR_NS::SdfPath& childName, const Geometry& previous) const;
+
 public:
     /// Disabled
     /// \{
@@ -49,7 +93,8 @@ public:
     /// \}
 
 protected:
-    ChildPrimMap m_children_map;  
+    ChildPrimMap        m_children_map;
+    ChildContentHashMap m_content_hashes;
 };
 
 } // namespace BifrostHd
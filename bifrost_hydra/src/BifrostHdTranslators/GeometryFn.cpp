@@ -20,8 +20,15 @@
 #include <Bifrost/Geometry/Primitives.h>
 #include <Bifrost/Object/bifrost_what_is.h>
 
-#include <pxr/base/gf/quath.h>
+#include <pxr/base/arch/hash.h>
+#include <pxr/base/gf/math.h>
+#include <pxr/base/gf/matrix4d.h>
+#include <pxr/base/gf/quatf.h>
 #include <pxr/base/gf/rotation.h>
+#include <pxr/base/gf/vec3f.h>
+#include <pxr/base/tf/hash.h>
+#include <pxr/base/vt/array.h>
+#include <pxr/base/work/loops.h>
 #include <pxr/imaging/hd/basisCurvesSchema.h>
 #include <pxr/imaging/hd/dataSource.h>
 #include <pxr/imaging/hd/instanceCategoriesSchema.h>
@@ -29,45 +36,85 @@
 #include <pxr/imaging/hd/instancer.h>
 #include <pxr/imaging/hd/instancerTopologySchema.h>
 #include <pxr/imaging/hd/meshSchema.h>
+#include <pxr/imaging/hd/overlayContainerDataSource.h>
 #include <pxr/imaging/hd/primvarsSchema.h>
 #include <pxr/imaging/hd/retainedDataSource.h>
 #include <pxr/imaging/hd/tokens.h>
 #include <pxr/imaging/hd/xformSchema.h>
 
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <functional>
 #include <iostream>
+#include <mutex>
+#include <numeric>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 PXR_NAMESPACE_USING_DIRECTIVE
 
 using BifrostGeoIndices  = Amino::Array<Bifrost::Geometry::Index>;
 using BifrostFloat3Array = Amino::Array<Bifrost::Math::float3>;
+using BifrostObjectPtr   = Amino::Ptr<Bifrost::Object>;
 
 namespace {
 
+const Amino::String kPointColorStr       = "point_color";
+const Amino::String kPointSizeStr        = "point_size";
+const Amino::String kPointIDStr          = "point_id";
+const Amino::String kPointInstanceIDStr  = "point_instance_id";
+const Amino::String kPointOrientationStr = "point_orientation";
+const Amino::String kPointScaleStr       = "point_scale";
+
+/// Foreign data source of the VtArrays aliasing the memory of an immutable
+/// Amino array. It holds the Amino array until the last of these VtArrays is
+/// destroyed, then deletes itself. Writing to such a VtArray copies it first.
+template <typename AminoT>
+class AminoArrayForeignDataSource : public Vt_ArrayForeignDataSource {
+public:
+    explicit AminoArrayForeignDataSource(
+        Amino::Ptr<Amino::Array<AminoT>> array)
+        : Vt_ArrayForeignDataSource(&AminoArrayForeignDataSource::Detached),
+          m_array(std::move(array)) {}
+
+private:
+    static void Detached(Vt_ArrayForeignDataSource* self) {
+        delete static_cast<AminoArrayForeignDataSource*>(self);
+    }
+
+    Amino::Ptr<Amino::Array<AminoT>> m_array;
+};
+
+/// Returns a VtArray aliasing the memory of the given Amino array, without
+/// copying it.
+template <typename VtT, typename AminoT>
+VtArray<VtT> AliasAminoArray(Amino::Ptr<Amino::Array<AminoT>> array) {
+    static_assert(sizeof(VtT) == sizeof(AminoT) &&
+                      alignof(VtT) <= alignof(AminoT),
+                  "Amino and Vt array elements must be layout compatible");
+    if (!array || array->empty()) {
+        return {};
+    }
+    auto* data = reinterpret_cast<VtT*>(const_cast<AminoT*>(&(*array)[0]));
+    const auto size = array->size();
+    return VtArray<VtT>(
+        new AminoArrayForeignDataSource<AminoT>(std::move(array)), data, size);
+}
+
 VtVec3fArray GetVec3fArray(const Bifrost::Object& object,
                            const Amino::String&   name) {
-    VtVec3fArray result;
-    const auto   data =
-        Bifrost::Geometry::getDataGeoPropValues<Bifrost::Math::float3>(object, name);
-    if (data) {
-        result.reserve(data->size());
-
-        for (size_t i = 0; i < data->size(); ++i) {
-            result.emplace_back((*data)[i].x, (*data)[i].y, (*data)[i].z);
-        }
-    }
-    return result;
+    return AliasAminoArray<GfVec3f>(
+        Bifrost::Geometry::getDataGeoPropValues<Bifrost::Math::float3>(object,
+                                                                       name));
 }
 
 VtIntArray GetIntArray(const Bifrost::Object& object,
                        const Amino::String&   name) {
-    VtIntArray result;
-    auto data = Bifrost::Geometry::getDataGeoPropValues<Bifrost::Geometry::Index>(
-        object, name);
-
-    if (data) {
-        result = VtIntArray{data->begin(), data->end()};
-    }
-    return result;
+    return AliasAminoArray<int>(
+        Bifrost::Geometry::getDataGeoPropValues<Bifrost::Geometry::Index>(
+            object, name));
 }
 
 VtIntArray BifrostOffsetsToUsdVertexCount(
@@ -85,15 +132,46 @@ VtIntArray BifrostOffsetsToUsdVertexCount(
     return vt_face_vertex_count;
 }
 
-class Matrix4dFromObjectDataSource : public HdMatrixDataSource {
+template <typename T>
+T InterpolateSample(const T& first, const T& second, const double alpha) {
+    return GfLerp(alpha, first, second);
+}
+
+template <>
+GfQuatf InterpolateSample(const GfQuatf& first, const GfQuatf& second,
+                          const double alpha) {
+    return GfSlerp(alpha, first, second);
+}
+
+/// Array data source holding the values of an array at several shutter
+/// offsets. The values in between are linearly interpolated, so that render
+/// delegates can motion blur the Bifrost geometries.
+template <typename T>
+class InterpolatedArrayDataSource : public HdTypedSampledDataSource<VtArray<T>> {
 public:
-    HD_DECLARE_DATASOURCE(Matrix4dFromObjectDataSource)
+    HD_DECLARE_DATASOURCE(InterpolatedArrayDataSource<T>)
+
+    using Time = HdSampledDataSource::Time;
 
     bool GetContributingSampleTimesForInterval(
-        Time /*startTime*/,
-        Time /*endTime*/,
-        std::vector<Time>* /*outSampleTimes*/) override {
-        (void)m_object;
+        Time startTime,
+        Time endTime,
+        std::vector<Time>* outSampleTimes) override {
+        if (m_times.size() < 2) {
+            return false;
+        }
+        if (outSampleTimes) {
+            outSampleTimes->clear();
+            outSampleTimes->push_back(startTime);
+            for (const auto time : m_times) {
+                if (time > startTime && time < endTime) {
+                    outSampleTimes->push_back(time);
+                }
+            }
+            if (endTime > startTime) {
+                outSampleTimes->push_back(endTime);
+            }
+        }
         return true;
     }
 
@@ -101,70 +179,195 @@ public:
         return VtValue(GetTypedValue(shutterOffset));
     }
 
-    GfMatrix4d GetTypedValue(Time /*shutterOffset*/) override {
-        (void)m_object;
-        // GfMatrix4d m = GfMatrix4d(1).SetTranslateOnly(p[_index]);
-        // return GfMatrix4d(1).SetScale(_scale) * m;
-        return GfMatrix4d(1);
+    VtArray<T> GetTypedValue(Time shutterOffset) override {
+        auto upper =
+            std::upper_bound(m_times.begin(), m_times.end(), shutterOffset);
+        if (upper == m_times.begin()) {
+            return m_values.front();
+        }
+        if (upper == m_times.end()) {
+            return m_values.back();
+        }
+
+        const auto  index  = static_cast<size_t>(upper - m_times.begin());
+        const auto& first  = m_values[index - 1];
+        const auto& second = m_values[index];
+        const double alpha = (shutterOffset - m_times[index - 1]) /
+                             (m_times[index] - m_times[index - 1]);
+
+        VtArray<T> result(first.size());
+        auto*      resultData = result.data();
+        for (size_t i = 0; i < first.size(); ++i) {
+            resultData[i] = InterpolateSample(first[i], second[i], alpha);
+        }
+        return result;
     }
 
 private:
-    explicit Matrix4dFromObjectDataSource(const Bifrost::Object& object)
-        : m_object(object) {}
+    /// \param [in] times The shutter offsets of the samples, sorted.
+    /// \param [in] values The values of the samples, all of the same size.
+    InterpolatedArrayDataSource(std::vector<Time>       times,
+                                std::vector<VtArray<T>> values)
+        : m_times(std::move(times)), m_values(std::move(values)) {}
+
+    std::vector<Time>       m_times;
+    std::vector<VtArray<T>> m_values;
+};
+
+/// Builds the data source of an array read from a Bifrost object with the
+/// given getter. If motion samples are given, the array is also read from
+/// the sampled objects and interpolated.
+template <typename T, typename Getter>
+HdSampledDataSourceHandle BuildSampledArrayDataSource(
+    const Bifrost::Object&          object,
+    const BifrostHd::MotionSamples& motionSamples,
+    Getter                          getter) {
+    VtArray<T> value = getter(object);
+    if (motionSamples.empty()) {
+        return HdRetainedTypedSampledDataSource<VtArray<T>>::New(value);
+    }
 
-    const Bifrost::Object& m_object;
+    using Time = HdSampledDataSource::Time;
+    std::vector<std::pair<Time, VtArray<T>>> samples;
+    samples.emplace_back(0.0f, value);
+    for (const auto& motionSample : motionSamples) {
+        if (!motionSample.object || motionSample.shutterOffset == 0.0f) {
+            continue;
+        }
+        VtArray<T> sampleValue = getter(*motionSample.object);
+        if (sampleValue.size() == value.size()) {
+            samples.emplace_back(motionSample.shutterOffset,
+                                 std::move(sampleValue));
+        }
+    }
+    if (samples.size() < 2) {
+        return HdRetainedTypedSampledDataSource<VtArray<T>>::New(value);
+    }
+
+    std::sort(samples.begin(), samples.end(),
+              [](const auto& a, const auto& b) { return a.first < b.first; });
+    std::vector<Time>       times;
+    std::vector<VtArray<T>> values;
+    times.reserve(samples.size());
+    values.reserve(samples.size());
+    for (auto& sample : samples) {
+        times.push_back(sample.first);
+        values.push_back(std::move(sample.second));
+    }
+    return InterpolatedArrayDataSource<T>::New(std::move(times),
+                                               std::move(values));
+}
+
+HdSampledDataSourceHandle BuildPointsDataSource(
+    const Bifrost::Object&          object,
+    const BifrostHd::MotionSamples& motionSamples) {
+    return BuildSampledArrayDataSource<GfVec3f>(
+        object, motionSamples,
+        [](const Bifrost::Object& obj) { return BifrostHd::GetPoints(obj); });
+}
+
+/// Container data source building its children only when they are asked
+/// for, so that the data a render delegate never reads is not converted.
+/// The built children are cached.
+class LazyContainerDataSource : public HdContainerDataSource {
+public:
+    HD_DECLARE_DATASOURCE(LazyContainerDataSource)
+
+    struct Child {
+        TfToken                                 name;
+        std::function<HdDataSourceBaseHandle()> build;
+        HdDataSourceBaseHandle                  dataSource;
+    };
+    using Children = std::vector<Child>;
+
+    TfTokenVector GetNames() override {
+        TfTokenVector names;
+        names.reserve(m_children.size());
+        for (const auto& child : m_children) {
+            names.push_back(child.name);
+        }
+        return names;
+    }
+
+    HdDataSourceBaseHandle Get(const TfToken& name) override {
+        for (auto& child : m_children) {
+            if (child.name == name) {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                if (child.build) {
+                    child.dataSource = child.build();
+                    // Releases the Bifrost object held by the function.
+                    child.build = nullptr;
+                }
+                return child.dataSource;
+            }
+        }
+        return nullptr;
+    }
+
+private:
+    explicit LazyContainerDataSource(Children children)
+        : m_children(std::move(children)) {}
+
+    Children   m_children;
+    std::mutex m_mutex;
 };
 
-HdContainerDataSourceHandle BuildXfromDataSource(
-    const Bifrost::Object& object) {
+HdContainerDataSourceHandle BuildXfromDataSource() {
+    // Bifrost geometries have no transform, their points are in world space.
     return HdXformSchema::Builder()
-        .SetMatrix(Matrix4dFromObjectDataSource::New(object))
+        .SetMatrix(HdRetainedTypedSampledDataSource<GfMatrix4d>::New(
+            GfMatrix4d(1)))
         .SetResetXformStack(HdRetainedTypedSampledDataSource<bool>::New(true))
         .Build();
 }
 
+HdContainerDataSourceHandle BuildPointsPrimvarDataSource(
+    const Bifrost::Object&          object,
+    const BifrostHd::MotionSamples& motionSamples) {
+    return HdPrimvarSchema::Builder()
+        .SetPrimvarValue(BuildPointsDataSource(object, motionSamples))
+        .SetInterpolation(HdPrimvarSchema::BuildInterpolationDataSource(
+            HdPrimvarSchemaTokens->vertex))
+        .SetRole(
+            HdPrimvarSchema::BuildRoleDataSource(HdPrimvarSchemaTokens->point))
+        .Build();
+}
+
+bool HasDisplayColor(const Bifrost::Object& object) {
+    const auto data =
+        Bifrost::Geometry::getDataGeoPropValues<Bifrost::Math::float3>(
+            object, kPointColorStr);
+    return data && !data->empty();
+}
+
 HdContainerDataSourceHandle BuildMeshPrimvarsDataSource(
-    const Bifrost::Object& object) {
-    auto displayColor = BifrostHd::GetDisplayColor(object);
-
-    if (displayColor.empty()) {
-        return HdRetainedContainerDataSource::New(
-            HdPrimvarsSchemaTokens->points,
-            HdPrimvarSchema::Builder()
-                .SetPrimvarValue(
-                    HdRetainedTypedSampledDataSource<VtVec3fArray>::New(
-                        BifrostHd::GetPoints(object)))
-                .SetInterpolation(HdPrimvarSchema::BuildInterpolationDataSource(
-                    HdPrimvarSchemaTokens->vertex))
-                .SetRole(HdPrimvarSchema::BuildRoleDataSource(
-                    HdPrimvarSchemaTokens->point))
-                .Build());
-    } else {
-        return HdRetainedContainerDataSource::New(
-            HdPrimvarsSchemaTokens->points,
-            HdPrimvarSchema::Builder()
-                .SetPrimvarValue(
-                    HdRetainedTypedSampledDataSource<VtVec3fArray>::New(
-                        BifrostHd::GetPoints(object)))
-                .SetInterpolation(HdPrimvarSchema::BuildInterpolationDataSource(
-                    HdPrimvarSchemaTokens->vertex))
-                .SetRole(HdPrimvarSchema::BuildRoleDataSource(
-                    HdPrimvarSchemaTokens->point))
-                .Build(),
-
-            HdTokens->displayColor,
-            HdPrimvarSchema::Builder()
-                .SetIndexedPrimvarValue(
-                    HdRetainedTypedSampledDataSource<VtVec3fArray>::New(
-                        displayColor))
-                .SetIndices(HdRetainedTypedSampledDataSource<VtIntArray>::New(
-                    BifrostHd::GetFaceVertexIndices(object)))
-                .SetInterpolation(HdPrimvarSchema::BuildInterpolationDataSource(
-                    HdPrimvarSchemaTokens->faceVarying))
-                .SetRole(HdPrimvarSchema::BuildRoleDataSource(
-                    HdPrimvarSchemaTokens->color))
-                .Build());
+    const BifrostObjectPtr&         object,
+    const BifrostHd::MotionSamples& motionSamples) {
+    LazyContainerDataSource::Children children{
+        {HdPrimvarsSchemaTokens->points,
+         [object, motionSamples]() -> HdDataSourceBaseHandle {
+             return BuildPointsPrimvarDataSource(*object, motionSamples);
+         }}};
+
+    if (HasDisplayColor(*object)) {
+        children.push_back(
+            {HdTokens->displayColor, [object]() -> HdDataSourceBaseHandle {
+                 return HdPrimvarSchema::Builder()
+                     .SetIndexedPrimvarValue(
+                         HdRetainedTypedSampledDataSource<VtVec3fArray>::New(
+                             BifrostHd::GetDisplayColor(*object)))
+                     .SetIndices(
+                         HdRetainedTypedSampledDataSource<VtIntArray>::New(
+                             BifrostHd::GetFaceVertexIndices(*object)))
+                     .SetInterpolation(
+                         HdPrimvarSchema::BuildInterpolationDataSource(
+                             HdPrimvarSchemaTokens->faceVarying))
+                     .SetRole(HdPrimvarSchema::BuildRoleDataSource(
+                         HdPrimvarSchemaTokens->color))
+                     .Build();
+             }});
     }
+    return LazyContainerDataSource::New(std::move(children));
 }
 
 HdContainerDataSourceHandle BuildMeshTopologyDataSource(
@@ -220,65 +423,138 @@ HdContainerDataSourceHandle BuildBasisCurveTopologyDataSource(
 }
 
 HdContainerDataSourceHandle BuildBasisCurvePrimvarsDataSource(
-    const Bifrost::Object& object) {
-    return HdRetainedContainerDataSource::New(
-        HdTokens->displayColor,
-        HdPrimvarSchema::Builder()
-            .SetPrimvarValue(
-                HdRetainedTypedSampledDataSource<VtVec3fArray>::New(
-                    BifrostHd::GetDisplayColor(object)))
-            .SetInterpolation(HdPrimvarSchema::BuildInterpolationDataSource(
-                HdPrimvarSchemaTokens->varying))
-            .SetRole(HdPrimvarSchema::BuildRoleDataSource(
-                HdPrimvarSchemaTokens->color))
-            .Build(),
-
-        HdPrimvarsSchemaTokens->points,
-        HdPrimvarSchema::Builder()
-            .SetPrimvarValue(
-                HdRetainedTypedSampledDataSource<VtVec3fArray>::New(
-                    BifrostHd::GetPoints(object)))
-            .SetInterpolation(HdPrimvarSchema::BuildInterpolationDataSource(
-                HdPrimvarSchemaTokens->vertex))
-            .SetRole(HdPrimvarSchema::BuildRoleDataSource(
-                HdPrimvarSchemaTokens->point))
-            .Build(),
-
-        HdTokens->widths,
-        HdPrimvarSchema::Builder()
-            .SetPrimvarValue(
-                HdRetainedTypedSampledDataSource<VtFloatArray>::New(
-                    BifrostHd::GetWidth(object)))
-            .SetInterpolation(HdPrimvarSchema::BuildInterpolationDataSource(
-                HdPrimvarSchemaTokens->vertex))
-            .SetRole(HdPrimvarSchema::BuildRoleDataSource(TfToken{}))
-            .Build()
-
-    );
-}
-
-HdContainerDataSourceHandle NewMeshDataSource(const Bifrost::Object& object) {
-    return HdRetainedContainerDataSource::New(
-        HdMeshSchemaTokens->mesh, BuildMeshTopologyDataSource(object),
-        HdPrimvarsSchemaTokens->primvars, BuildMeshPrimvarsDataSource(object),
-        HdXformSchemaTokens->xform, BuildXfromDataSource(object));
+    const BifrostObjectPtr&         object,
+    const BifrostHd::MotionSamples& motionSamples) {
+    return LazyContainerDataSource::New(LazyContainerDataSource::Children{
+        {HdTokens->displayColor,
+         [object]() -> HdDataSourceBaseHandle {
+             return HdPrimvarSchema::Builder()
+                 .SetPrimvarValue(
+                     HdRetainedTypedSampledDataSource<VtVec3fArray>::New(
+                         BifrostHd::GetDisplayColor(*object)))
+                 .SetInterpolation(
+                     HdPrimvarSchema::BuildInterpolationDataSource(
+                         HdPrimvarSchemaTokens->varying))
+                 .SetRole(HdPrimvarSchema::BuildRoleDataSource(
+                     HdPrimvarSchemaTokens->color))
+                 .Build();
+         }},
+
+        {HdPrimvarsSchemaTokens->points,
+         [object, motionSamples]() -> HdDataSourceBaseHandle {
+             return BuildPointsPrimvarDataSource(*object, motionSamples);
+         }},
+
+        {HdTokens->widths, [object]() -> HdDataSourceBaseHandle {
+             return HdPrimvarSchema::Builder()
+                 .SetPrimvarValue(
+                     HdRetainedTypedSampledDataSource<VtFloatArray>::New(
+                         BifrostHd::GetWidth(*object)))
+                 .SetInterpolation(
+                     HdPrimvarSchema::BuildInterpolationDataSource(
+                         HdPrimvarSchemaTokens->vertex))
+                 .SetRole(HdPrimvarSchema::BuildRoleDataSource(TfToken{}))
+                 .Build();
+         }}});
+}
+
+bool HasWidth(const Bifrost::Object& object) {
+    const auto data = Bifrost::Geometry::getDataGeoPropValues<Amino::float_t>(
+        object, kPointSizeStr);
+    return data && !data->empty();
+}
+
+HdContainerDataSourceHandle BuildPointsPrimvarsDataSource(
+    const BifrostObjectPtr&         object,
+    const BifrostHd::MotionSamples& motionSamples) {
+    LazyContainerDataSource::Children children{
+        {HdPrimvarsSchemaTokens->points,
+         [object, motionSamples]() -> HdDataSourceBaseHandle {
+             return BuildPointsPrimvarDataSource(*object, motionSamples);
+         }}};
+
+    // Without widths and colors, render delegates use their defaults.
+    if (HasWidth(*object)) {
+        children.push_back(
+            {HdTokens->widths, [object]() -> HdDataSourceBaseHandle {
+                 return HdPrimvarSchema::Builder()
+                     .SetPrimvarValue(
+                         HdRetainedTypedSampledDataSource<VtFloatArray>::New(
+                             BifrostHd::GetWidth(*object)))
+                     .SetInterpolation(
+                         HdPrimvarSchema::BuildInterpolationDataSource(
+                             HdPrimvarSchemaTokens->vertex))
+                     .SetRole(HdPrimvarSchema::BuildRoleDataSource(TfToken{}))
+                     .Build();
+             }});
+    }
+    if (HasDisplayColor(*object)) {
+        children.push_back(
+            {HdTokens->displayColor, [object]() -> HdDataSourceBaseHandle {
+                 return HdPrimvarSchema::Builder()
+                     .SetPrimvarValue(
+                         HdRetainedTypedSampledDataSource<VtVec3fArray>::New(
+                             BifrostHd::GetDisplayColor(*object)))
+                     .SetInterpolation(
+                         HdPrimvarSchema::BuildInterpolationDataSource(
+                             HdPrimvarSchemaTokens->vertex))
+                     .SetRole(HdPrimvarSchema::BuildRoleDataSource(
+                         HdPrimvarSchemaTokens->color))
+                     .Build();
+             }});
+    }
+    return LazyContainerDataSource::New(std::move(children));
+}
+
+HdContainerDataSourceHandle NewMeshDataSource(
+    const BifrostObjectPtr&         object,
+    const BifrostHd::MotionSamples& motionSamples) {
+    return LazyContainerDataSource::New(LazyContainerDataSource::Children{
+        {HdMeshSchemaTokens->mesh,
+         [object]() -> HdDataSourceBaseHandle {
+             return BuildMeshTopologyDataSource(*object);
+         }},
+        {HdPrimvarsSchemaTokens->primvars,
+         [object, motionSamples]() -> HdDataSourceBaseHandle {
+             return BuildMeshPrimvarsDataSource(object, motionSamples);
+         }},
+        {HdXformSchemaTokens->xform,
+         []() -> HdDataSourceBaseHandle { return BuildXfromDataSource(); }}});
 }
 
 HdContainerDataSourceHandle NewBasisCurveDataSource(
-    const Bifrost::Object& object) {
-    return HdRetainedContainerDataSource::New(
-        HdBasisCurvesSchemaTokens->basisCurves,
-        BuildBasisCurveTopologyDataSource(object),
-        HdPrimvarsSchemaTokens->primvars,
-        BuildBasisCurvePrimvarsDataSource(object), HdXformSchemaTokens->xform,
-        BuildXfromDataSource(object));
+    const BifrostObjectPtr&         object,
+    const BifrostHd::MotionSamples& motionSamples) {
+    return LazyContainerDataSource::New(LazyContainerDataSource::Children{
+        {HdBasisCurvesSchemaTokens->basisCurves,
+         [object]() -> HdDataSourceBaseHandle {
+             return BuildBasisCurveTopologyDataSource(*object);
+         }},
+        {HdPrimvarsSchemaTokens->primvars,
+         [object, motionSamples]() -> HdDataSourceBaseHandle {
+             return BuildBasisCurvePrimvarsDataSource(object, motionSamples);
+         }},
+        {HdXformSchemaTokens->xform,
+         []() -> HdDataSourceBaseHandle { return BuildXfromDataSource(); }}});
+}
+
+HdContainerDataSourceHandle NewPointsDataSource(
+    const BifrostObjectPtr&         object,
+    const BifrostHd::MotionSamples& motionSamples) {
+    return LazyContainerDataSource::New(LazyContainerDataSource::Children{
+        {HdPrimvarsSchemaTokens->primvars,
+         [object, motionSamples]() -> HdDataSourceBaseHandle {
+             return BuildPointsPrimvarsDataSource(object, motionSamples);
+         }},
+        {HdXformSchemaTokens->xform,
+         []() -> HdDataSourceBaseHandle { return BuildXfromDataSource(); }}});
 }
 
 HdContainerDataSourceHandle BuildInstancerTranslateDataSource(
-    const Bifrost::Object& object) {
+    const Bifrost::Object&          object,
+    const BifrostHd::MotionSamples& motionSamples) {
     return HdPrimvarSchema::Builder()
-        .SetPrimvarValue(HdRetainedTypedSampledDataSource<VtVec3fArray>::New(
-            BifrostHd::GetPoints(object)))
+        .SetPrimvarValue(BuildPointsDataSource(object, motionSamples))
         .SetInterpolation(HdPrimvarSchema::BuildInterpolationDataSource(
             HdPrimvarSchemaTokens->instance))
         .SetRole(
@@ -287,13 +563,13 @@ HdContainerDataSourceHandle BuildInstancerTranslateDataSource(
 }
 
 HdContainerDataSourceHandle BuildInstancerRotateDataSource(
-    const Bifrost::Object& object) {
-    auto         rotationsSize = BifrostHd::GetPoints(object).size();
-    VtQuathArray rotations{rotationsSize, GfQuath{1, 0, 0, 0}};
-
+    const Bifrost::Object&          object,
+    const BifrostHd::MotionSamples& motionSamples) {
     return HdPrimvarSchema::Builder()
-        .SetPrimvarValue(
-            HdRetainedTypedSampledDataSource<VtQuathArray>::New(rotations))
+        .SetPrimvarValue(BuildSampledArrayDataSource<GfQuatf>(
+            object, motionSamples, [](const Bifrost::Object& obj) {
+                return BifrostHd::GetOrientations(obj);
+            }))
         .SetInterpolation(HdPrimvarSchema::BuildInterpolationDataSource(
             HdPrimvarSchemaTokens->instance))
         .SetRole(HdPrimvarSchema::BuildRoleDataSource(TfToken{""}))
@@ -301,13 +577,13 @@ HdContainerDataSourceHandle BuildInstancerRotateDataSource(
 }
 
 HdContainerDataSourceHandle BuildInstancerScaleDataSource(
-    const Bifrost::Object& object) {
-    auto         scaleSize = BifrostHd::GetPoints(object).size();
-    VtVec3fArray scales{scaleSize, GfVec3f{1, 1, 1}};
-
+    const Bifrost::Object&          object,
+    const BifrostHd::MotionSamples& motionSamples) {
     return HdPrimvarSchema::Builder()
-        .SetPrimvarValue(
-            HdRetainedTypedSampledDataSource<VtVec3fArray>::New(scales))
+        .SetPrimvarValue(BuildSampledArrayDataSource<GfVec3f>(
+            object, motionSamples, [](const Bifrost::Object& obj) {
+                return BifrostHd::GetScales(obj);
+            }))
         .SetInterpolation(HdPrimvarSchema::BuildInterpolationDataSource(
             HdPrimvarSchemaTokens->instance))
         .SetRole(HdPrimvarSchema::BuildRoleDataSource(TfToken{""}))
@@ -338,26 +614,47 @@ HdContainerDataSourceHandle GetInstancerInstanceCategoriesDataSource() {
 }
 
 HdContainerDataSourceHandle NewPointInstancerPrimvarsDataSource(
-    const Bifrost::Object& object) {
-    return HdRetainedContainerDataSource::New(
-        HdInstancerTokens->rotate, BuildInstancerRotateDataSource(object),
-        HdInstancerTokens->scale, BuildInstancerScaleDataSource(object),
-        HdInstancerTokens->translate,
-        BuildInstancerTranslateDataSource(object));
+    const BifrostObjectPtr&         object,
+    const BifrostHd::MotionSamples& motionSamples) {
+    return LazyContainerDataSource::New(LazyContainerDataSource::Children{
+        {HdInstancerTokens->rotate,
+         [object, motionSamples]() -> HdDataSourceBaseHandle {
+             return BuildInstancerRotateDataSource(*object, motionSamples);
+         }},
+        {HdInstancerTokens->scale,
+         [object, motionSamples]() -> HdDataSourceBaseHandle {
+             return BuildInstancerScaleDataSource(*object, motionSamples);
+         }},
+        {HdInstancerTokens->translate,
+         [object, motionSamples]() -> HdDataSourceBaseHandle {
+             return BuildInstancerTranslateDataSource(*object, motionSamples);
+         }}});
+}
+
+int GetPrototypeIndex(const BifrostHd::InstancerPrototypes& prototypes,
+                      const int64_t                         shapeID) {
+    if (shapeID < 0 ||
+        static_cast<size_t>(shapeID) >= prototypes.shapePrototypes.size()) {
+        return -1;
+    }
+    return prototypes.shapePrototypes[static_cast<size_t>(shapeID)];
 }
 
 HdContainerDataSourceHandle BuildPointInstancerTopologyDataSource(
-    const Bifrost::Object& object) {
+    const Bifrost::Object&                object,
+    const BifrostHd::InstancerPrototypes& prototypes) {
     HdContainerDataSourceHandle data_source;
 
     const auto pointInstanceIDs = BifrostHd::GetPointInstanceIDs(object);
 
     // We need to flip the pointInstanceIDs: [0,1,0] -> 0: [0,2], 1: [1].
-    std::vector<VtIntArray> instanceIndices;
+    std::vector<VtIntArray> instanceIndices(prototypes.paths.size());
     for (size_t i = 0; i < pointInstanceIDs.size(); ++i) {
-        const int protoIndex = static_cast<int>(pointInstanceIDs[i]);
-        if (size_t(protoIndex) >= instanceIndices.size()) {
-            instanceIndices.resize(protoIndex + 1);
+        const int protoIndex =
+            GetPrototypeIndex(prototypes, pointInstanceIDs[i]);
+        if (protoIndex < 0 ||
+            static_cast<size_t>(protoIndex) >= instanceIndices.size()) {
+            continue;
         }
         instanceIndices[protoIndex].push_back(static_cast<int>(i));
     }
@@ -369,14 +666,11 @@ HdContainerDataSourceHandle BuildPointInstancerTopologyDataSource(
                 instanceIndices[i]));
     }
 
-    VtArray<SdfPath> prototypes{
-        SdfPath{"/instancer/prototypes/mesh/proto0_mesh_id0"}};
-
     using PathArrayDataSource =
         HdRetainedTypedSampledDataSource<VtArray<SdfPath>>;
 
     data_source = HdInstancerTopologySchema::Builder()
-                      .SetPrototypes(PathArrayDataSource::New(prototypes))
+                      .SetPrototypes(PathArrayDataSource::New(prototypes.paths))
                       .SetInstanceIndices(HdRetainedSmallVectorDataSource::New(
                           indicesVec.size(), indicesVec.data()))
                       // TODO(laforgg): .SetInstanceLocations()
@@ -386,84 +680,180 @@ HdContainerDataSourceHandle BuildPointInstancerTopologyDataSource(
 }
 
 HdContainerDataSourceHandle NewPointInstancerDataSource(
-    const Bifrost::Object& object) {
+    const BifrostObjectPtr&               object,
+    const BifrostHd::InstancerPrototypes& prototypes,
+    const BifrostHd::MotionSamples&       motionSamples) {
     (void)BuildInstancerInstancedByDataSource();
-    return HdRetainedContainerDataSource::New(
-        HdInstancerTopologySchemaTokens->instancerTopology,
-        BuildPointInstancerTopologyDataSource(object),
-        HdXformSchemaTokens->xform, BuildXfromDataSource(object),
-        HdPrimvarsSchemaTokens->primvars,
-        NewPointInstancerPrimvarsDataSource(object),
-        // HdInstancedBySchemaTokens->instancedBy,
-        // BuildInstancerInstancedByDataSource(),
-        HdInstanceCategoriesSchemaTokens->instanceCategories,
-        GetInstancerInstanceCategoriesDataSource());
+    return LazyContainerDataSource::New(LazyContainerDataSource::Children{
+        {HdInstancerTopologySchemaTokens->instancerTopology,
+         [object, prototypes]() -> HdDataSourceBaseHandle {
+             return BuildPointInstancerTopologyDataSource(*object, prototypes);
+         }},
+        {HdXformSchemaTokens->xform,
+         []() -> HdDataSourceBaseHandle { return BuildXfromDataSource(); }},
+        {HdPrimvarsSchemaTokens->primvars,
+         [object, motionSamples]() -> HdDataSourceBaseHandle {
+             return NewPointInstancerPrimvarsDataSource(object, motionSamples);
+         }},
+        // {HdInstancedBySchemaTokens->instancedBy,
+        //  BuildInstancerInstancedByDataSource()},
+        {HdInstanceCategoriesSchemaTokens->instanceCategories,
+         []() -> HdDataSourceBaseHandle {
+             return GetInstancerInstanceCategoriesDataSource();
+         }}});
 }
 
+/// Hashes the bytes of an Amino array, without converting it.
 template <typename T>
-VtArray<T> GetArrayFromPrimvarName(HdPrimvarsSchema& primvarsSchema,
-                                   const TfToken&    name) {
-    VtArray<T> result;
-    auto       primvar = primvarsSchema.GetPrimvar(name);
-    if (primvar.IsDefined()) {
-        if (auto dataSource = primvar.GetPrimvarValue()) {
-            auto value = dataSource->GetValue(0.0f);
-            if (value.IsHolding<VtArray<T>>()) {
-                result = value.UncheckedGet<VtArray<T>>();
-            }
-        }
+size_t HashAminoArray(const Amino::Ptr<Amino::Array<T>>& array) {
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "Amino array elements must be hashable as bytes");
+    if (!array || array->empty()) {
+        return 0;
     }
-    return result;
+    return TfHash::Combine(
+        array->size(),
+        ArchHash64(reinterpret_cast<const char*>(&(*array)[0]),
+                   array->size() * sizeof(T)));
 }
 
-template <typename T>
-bool AddScalarArrayToMesh(const Amino::String&                name,
-                          HdPrimvarsSchema&                   primvarsSchema,
-                          Bifrost::Object& mesh) {
-    auto data =
-        GetArrayFromPrimvarName<T>(primvarsSchema, TfToken{name.c_str()});
-
-    if (data.size() > 0) {
-        auto obj = Bifrost::createObject();
-        Bifrost::Geometry::populateDataGeoProp<T>(T{}, *obj);
-        obj->setProperty(Bifrost::Geometry::sTarget,
-                         Bifrost::Geometry::sPointComp);
-        mesh.setProperty(name, std::move(obj));
-
-        auto array = Amino::newMutablePtr<Amino::Array<T>>(data.size());
-        for (size_t i = 0; i < data.size(); ++i) {
-            (*array)[i] = data[i];
+/// Builds the ContentHash of the data at a locator from the Amino arrays and
+/// the other values it is read from.
+class ContentHashBuilder {
+public:
+    explicit ContentHashBuilder(const HdDataSourceLocator& locator) {
+        m_hash.locator = locator;
+    }
+
+    template <typename T>
+    ContentHashBuilder& AddArray(const Bifrost::Object& object,
+                                 const Amino::String&   name) {
+        auto array =
+            Bifrost::Geometry::getDataGeoPropValues<T>(object, name);
+        m_hash.arrays.push_back(array ? &*array : nullptr);
+        m_arrayHashes.push_back(
+            [array]() { return HashAminoArray(array); });
+        return *this;
+    }
+
+    template <typename... Args>
+    ContentHashBuilder& AddKey(const Args&... values) {
+        m_hash.key = TfHash::Combine(m_hash.key, values...);
+        return *this;
+    }
+
+    /// Adds the array of the object and of its motion samples.
+    template <typename T>
+    ContentHashBuilder& AddSampledArray(
+        const Bifrost::Object&          object,
+        const BifrostHd::MotionSamples& motionSamples,
+        const Amino::String&            name) {
+        AddArray<T>(object, name);
+        for (const auto& motionSample : motionSamples) {
+            if (motionSample.object) {
+                AddKey(motionSample.shutterOffset);
+                AddArray<T>(*motionSample.object, name);
+            }
         }
-        Bifrost::Geometry::setDataGeoPropValues(name, array.toImmutable(), mesh);
-        return true;
+        return *this;
+    }
+
+    BifrostHd::ContentHash Build() {
+        m_hash.hashArrays = [arrayHashes = std::move(m_arrayHashes)]() {
+            size_t hash = 0;
+            for (const auto& arrayHash : arrayHashes) {
+                hash = TfHash::Combine(hash, arrayHash());
+            }
+            return hash;
+        };
+        return std::move(m_hash);
     }
-    return false;
+
+private:
+    BifrostHd::ContentHash               m_hash;
+    std::vector<std::function<size_t()>> m_arrayHashes;
+};
+
+BifrostHd::ContentHash HashPoints(
+    const Bifrost::Object&          object,
+    const BifrostHd::MotionSamples& motionSamples,
+    const HdDataSourceLocator&      locator) {
+    return ContentHashBuilder(locator)
+        .AddSampledArray<Bifrost::Math::float3>(object, motionSamples,
+                                                Bifrost::Geometry::sPositions)
+        .Build();
 }
 
-template <typename T1, typename T2>
-bool AddVec3ArrayToMesh(const Amino::String&                name,
-                        HdPrimvarsSchema&                   primvarsSchema,
-                        Amino::MutablePtr<Bifrost::Object>& mesh) {
-    auto data =
-        GetArrayFromPrimvarName<T1>(primvarsSchema, TfToken{name.c_str()});
+HdDataSourceLocator PrimvarLocator(const TfToken& name) {
+    return HdPrimvarsSchema::GetDefaultLocator().Append(name);
+}
 
-    if (data.size() > 0) {
-        auto obj = Bifrost::createObject();
-        Bifrost::Geometry::populateDataGeoProp<T2>(T2{}, *obj);
-        obj->setProperty(Bifrost::Geometry::sTarget,
-                         Bifrost::Geometry::sPointComp);
-        mesh->setProperty(name, std::move(obj));
+/// Returns an Amino array holding a copy of the given VtArray, copied with
+/// a single memory copy.
+template <typename AminoT, typename VtT>
+Amino::Ptr<Amino::Array<AminoT>> CopyToAminoArray(const VtArray<VtT>& array) {
+    static_assert(sizeof(VtT) == sizeof(AminoT) &&
+                      std::is_trivially_copyable<VtT>::value &&
+                      std::is_trivially_copyable<AminoT>::value,
+                  "Amino and Vt array elements must be layout compatible");
+    auto result = Amino::newMutablePtr<Amino::Array<AminoT>>(array.size());
+    if (!array.empty()) {
+        std::memcpy(static_cast<void*>(&(*result)[0]),
+                    static_cast<const void*>(array.cdata()),
+                    array.size() * sizeof(VtT));
+    }
+    return result.toImmutable();
+}
 
-        auto array = Amino::newMutablePtr<Amino::Array<T2>>(data.size());
-        for (size_t i = 0; i < data.size(); ++i) {
-            (*array)[i].x = data[i][0];
-            (*array)[i].y = data[i][1];
-            (*array)[i].z = data[i][2];
+/// Converts USD face vertex counts to Bifrost face offsets, which have one
+/// more element. The prefix sum is computed in parallel by blocks.
+Amino::Ptr<BifrostGeoIndices> UsdVertexCountToBifrostOffsets(
+    const VtIntArray& counts) {
+    constexpr size_t kBlockSize = 1 << 16;
+    const size_t     count      = counts.size();
+    const size_t     blockCount = (count + kBlockSize - 1) / kBlockSize;
+    const int*       countsData = counts.cdata();
+
+    // The offset at the beginning of each block.
+    std::vector<Bifrost::Geometry::Index> blockOffsets(blockCount + 1, 0);
+    WorkParallelForN(blockCount, [&](size_t begin, size_t end) {
+        for (size_t block = begin; block < end; ++block) {
+            const size_t last = std::min(count, (block + 1) * kBlockSize);
+            Bifrost::Geometry::Index sum = 0;
+            for (size_t i = block * kBlockSize; i < last; ++i) {
+                sum += static_cast<Bifrost::Geometry::Index>(countsData[i]);
+            }
+            blockOffsets[block + 1] = sum;
         }
-        Bifrost::Geometry::setDataGeoPropValues(name, array.toImmutable(), *mesh);
-        return true;
-    }
-    return false;
+    });
+    std::partial_sum(blockOffsets.begin(), blockOffsets.end(),
+                     blockOffsets.begin());
+
+    auto offsets = Amino::newMutablePtr<BifrostGeoIndices>(count + 1);
+    auto* offsetsData = &(*offsets)[0];
+    WorkParallelForN(blockCount, [&](size_t begin, size_t end) {
+        for (size_t block = begin; block < end; ++block) {
+            const size_t last   = std::min(count, (block + 1) * kBlockSize);
+            auto         offset = blockOffsets[block];
+            for (size_t i = block * kBlockSize; i < last; ++i) {
+                offsetsData[i] = offset;
+                offset += static_cast<Bifrost::Geometry::Index>(countsData[i]);
+            }
+        }
+    });
+    offsetsData[count] = blockOffsets[blockCount];
+    return offsets.toImmutable();
+}
+
+template <typename T>
+void AddPointDataToMesh(const Amino::String&        name,
+                        Amino::Ptr<Amino::Array<T>> values,
+                        Bifrost::Object&            mesh) {
+    auto obj = Bifrost::createObject();
+    Bifrost::Geometry::populateDataGeoProp<T>(T{}, *obj);
+    obj->setProperty(Bifrost::Geometry::sTarget, Bifrost::Geometry::sPointComp);
+    mesh.setProperty(name, std::move(obj));
+    Bifrost::Geometry::setDataGeoPropValues(name, std::move(values), mesh);
 }
 } // namespace
 
@@ -482,7 +872,7 @@ BifrostHdGeoTypes GetGeoType(const Bifrost::Object& object) {
     } else if (objType == Bifrost::Geometry::getPointCloudPrototype()) {
         return BifrostHdGeoTypes::PointCloud;
     } else if (objType == Bifrost::Geometry::getInstancesPrototype()) {
-        return BifrostHdGeoTypes::PointCloud;
+        return BifrostHdGeoTypes::Instances;
     }
 
     return BifrostHdGeoTypes::Empty;
@@ -498,8 +888,7 @@ VtVec3fArray GetPoints(const Bifrost::Object& object) {
 }
 
 VtVec3fArray GetDisplayColor(const Bifrost::Object& object) {
-    static const Amino::String kPointColorStr = "point_color";
-    VtVec3fArray               result = GetVec3fArray(object, kPointColorStr);
+    VtVec3fArray result = GetVec3fArray(object, kPointColorStr);
     return result;
 }
 
@@ -508,40 +897,52 @@ VtIntArray GetFaceVertexIndices(const Bifrost::Object& object) {
 }
 
 VtFloatArray GetWidth(const Bifrost::Object& object) {
-    static const Amino::String kPointSizeStr = "point_size";
-    VtFloatArray               result;
-    const auto                 data =
-        Bifrost::Geometry::getDataGeoPropValues<Amino::float_t>(object, kPointSizeStr);
-    if (data) {
-        result = {data->begin(), data->end()};
-    }
-    return result;
+    return AliasAminoArray<float>(
+        Bifrost::Geometry::getDataGeoPropValues<Amino::float_t>(object,
+                                                                kPointSizeStr));
 }
 
 VtInt64Array GetPointIDs(const Bifrost::Object& object) {
-    static const Amino::String kPointIDStr = "point_id";
-
-    VtInt64Array result;
-    const auto   data =
-        Bifrost::Geometry::getDataGeoPropValues<Amino::long_t>(object, kPointIDStr);
-    if (data) {
-        result = {data->begin(), data->end()};
-    }
-    return result;
+    return AliasAminoArray<int64_t>(
+        Bifrost::Geometry::getDataGeoPropValues<Amino::long_t>(object,
+                                                               kPointIDStr));
 }
 
 // instancer
 
 VtInt64Array GetPointInstanceIDs(const Bifrost::Object& object) {
-    static const Amino::String kPointInstanceIDStr = "point_instance_id";
+    return AliasAminoArray<int64_t>(
+        Bifrost::Geometry::getDataGeoPropValues<Amino::long_t>(
+            object, kPointInstanceIDStr));
+}
 
-    VtInt64Array result;
-    const auto   data = Bifrost::Geometry::getDataGeoPropValues<Amino::long_t>(
-        object, kPointInstanceIDStr);
-    if (data) {
-        result = {data->begin(), data->end()};
+VtQuatfArray GetOrientations(const Bifrost::Object& object) {
+    const size_t pointCount = GetPointCount(object);
+    // Bifrost quaternions are stored as (x, y, z, w), as GfQuatf is.
+    auto orientations = AliasAminoArray<GfQuatf>(
+        Bifrost::Geometry::getDataGeoPropValues<Bifrost::Math::float4>(
+            object, kPointOrientationStr));
+    if (orientations.size() != pointCount) {
+        return VtQuatfArray(pointCount, GfQuatf::GetIdentity());
     }
-    return result;
+    return orientations;
+}
+
+VtVec3fArray GetScales(const Bifrost::Object& object) {
+    const size_t pointCount = GetPointCount(object);
+    VtVec3fArray scales     = GetVec3fArray(object, kPointScaleStr);
+    if (scales.size() != pointCount) {
+        scales = VtVec3fArray(pointCount, GfVec3f(1.0f));
+    }
+    const auto sizes = GetWidth(object);
+    if (sizes.size() == pointCount) {
+        // Copies the aliased Bifrost scales.
+        auto* scalesData = scales.data();
+        for (size_t i = 0; i < pointCount; ++i) {
+            scalesData[i] *= sizes[i];
+        }
+    }
+    return scales;
 }
 
 Amino::Ptr<Bifrost::Object> GetInstanceShape(const Bifrost::Object& object) {
@@ -581,28 +982,179 @@ Amino::Ptr<Bifrost::Object> GetRenderGeometry(const Bifrost::Object& object) {
 
 // Bifrost to Hydra
 
-HdSceneIndexPrim CreateHdSceneIndexMesh(const Bifrost::Object& object) {
+HdSceneIndexPrim CreateHdSceneIndexMesh(const BifrostObjectPtr& object,
+                                        const MotionSamples&    motionSamples) {
     HdSceneIndexPrim result;
     result.primType   = HdPrimTypeTokens->mesh;
-    result.dataSource = NewMeshDataSource(object);
+    result.dataSource = NewMeshDataSource(object, motionSamples);
 
     return result;
 }
 
-HdSceneIndexPrim CreateHdSceneIndexBasisCurves(const Bifrost::Object& object) {
+HdSceneIndexPrim CreateHdSceneIndexBasisCurves(
+    const BifrostObjectPtr& object, const MotionSamples& motionSamples) {
     HdSceneIndexPrim result;
     result.primType   = HdPrimTypeTokens->basisCurves;
-    result.dataSource = NewBasisCurveDataSource(object);
+    result.dataSource = NewBasisCurveDataSource(object, motionSamples);
+
+    return result;
+}
+
+HdSceneIndexPrim CreateHdSceneIndexPoints(const BifrostObjectPtr& object,
+                                          const MotionSamples& motionSamples) {
+    HdSceneIndexPrim result;
+    result.primType   = HdPrimTypeTokens->points;
+    result.dataSource = NewPointsDataSource(object, motionSamples);
 
     return result;
 }
 
 HdSceneIndexPrim CreateHdSceneIndexExplicitInstancer(
-    const Bifrost::Object& object) {
+    const BifrostObjectPtr&    object,
+    const InstancerPrototypes& prototypes,
+    const MotionSamples&       motionSamples) {
+    HdSceneIndexPrim result;
+    result.primType = HdPrimTypeTokens->instancer;
+    result.dataSource =
+        NewPointInstancerDataSource(object, prototypes, motionSamples);
+
+    return result;
+}
+
+HdSceneIndexPrim CreateHdSceneIndexPrototype(const BifrostObjectPtr& object,
+                                             const SdfPath& instancerPath) {
     HdSceneIndexPrim result;
-    result.primType   = HdPrimTypeTokens->instancer;
-    result.dataSource = NewPointInstancerDataSource(object);
+    switch (GetGeoType(*object)) {
+        case BifrostHdGeoTypes::Mesh:
+            result = CreateHdSceneIndexMesh(object);
+            break;
+        case BifrostHdGeoTypes::Strands:
+            result = CreateHdSceneIndexBasisCurves(object);
+            break;
+        default: return result;
+    }
+
+    // Prototypes are only drawn by their instancer.
+    result.dataSource = HdOverlayContainerDataSource::New(
+        HdRetainedContainerDataSource::New(
+            HdInstancedBySchemaTokens->instancedBy,
+            HdInstancedBySchema::Builder()
+                .SetPaths(
+                    HdRetainedTypedSampledDataSource<VtArray<SdfPath>>::New(
+                        VtArray<SdfPath>{instancerPath}))
+                .Build()),
+        result.dataSource);
+    return result;
+}
+
+ContentHashes HashHdSceneIndexMesh(const Bifrost::Object& object,
+                                   const MotionSamples&   motionSamples) {
+    using Bifrost::Geometry::Index;
+    ContentHashes result;
+    result.push_back(
+        ContentHashBuilder(HdMeshSchema::GetTopologyLocator())
+            .AddArray<Index>(object, Bifrost::Geometry::sFaceOffsets)
+            .AddArray<Index>(object, Bifrost::Geometry::sFaceVertices)
+            .Build());
+    result.push_back(HashPoints(object, motionSamples,
+                                HdPrimvarsSchema::GetPointsLocator()));
+    if (HasDisplayColor(object)) {
+        result.push_back(
+            ContentHashBuilder(PrimvarLocator(HdTokens->displayColor))
+                .AddArray<Bifrost::Math::float3>(object, kPointColorStr)
+                .AddArray<Index>(object, Bifrost::Geometry::sFaceVertices)
+                .Build());
+    }
+    return result;
+}
+
+ContentHashes HashHdSceneIndexBasisCurves(const Bifrost::Object& object,
+                                          const MotionSamples& motionSamples) {
+    using Bifrost::Geometry::Index;
+    ContentHashes result;
+    result.push_back(
+        ContentHashBuilder(HdBasisCurvesSchema::GetTopologyLocator())
+            .AddArray<Index>(object, Bifrost::Geometry::sStrandOffsets)
+            .AddArray<Index>(object, Bifrost::Geometry::sFaceVertices)
+            .Build());
+    result.push_back(HashPoints(object, motionSamples,
+                                HdPrimvarsSchema::GetPointsLocator()));
+    result.push_back(
+        ContentHashBuilder(PrimvarLocator(HdTokens->displayColor))
+            .AddArray<Bifrost::Math::float3>(object, kPointColorStr)
+            .Build());
+    result.push_back(ContentHashBuilder(PrimvarLocator(HdTokens->widths))
+                         .AddArray<Amino::float_t>(object, kPointSizeStr)
+                         .Build());
+    return result;
+}
+
+ContentHashes HashHdSceneIndexPoints(const Bifrost::Object& object,
+                                     const MotionSamples&   motionSamples) {
+    ContentHashes result;
+    result.push_back(HashPoints(object, motionSamples,
+                                HdPrimvarsSchema::GetPointsLocator()));
+    if (HasWidth(object)) {
+        result.push_back(ContentHashBuilder(PrimvarLocator(HdTokens->widths))
+                             .AddArray<Amino::float_t>(object, kPointSizeStr)
+                             .Build());
+    }
+    if (HasDisplayColor(object)) {
+        result.push_back(
+            ContentHashBuilder(PrimvarLocator(HdTokens->displayColor))
+                .AddArray<Bifrost::Math::float3>(object, kPointColorStr)
+                .Build());
+    }
+    return result;
+}
+
+ContentHashes HashHdSceneIndexExplicitInstancer(
+    const Bifrost::Object&     object,
+    const InstancerPrototypes& prototypes,
+    const MotionSamples&       motionSamples) {
+    // The rotations and scales default to the point count when their arrays
+    // are missing, so it is part of their keys.
+    ContentHashes result;
+    result.push_back(
+        ContentHashBuilder(HdInstancerTopologySchema::GetDefaultLocator())
+            .AddArray<Amino::long_t>(object, kPointInstanceIDStr)
+            .AddKey(prototypes.paths, prototypes.shapePrototypes)
+            .Build());
+    result.push_back(HashPoints(object, motionSamples,
+                                PrimvarLocator(HdInstancerTokens->translate)));
+    result.push_back(
+        ContentHashBuilder(PrimvarLocator(HdInstancerTokens->rotate))
+            .AddKey(GetPointCount(object))
+            .AddSampledArray<Bifrost::Math::float4>(object, motionSamples,
+                                                    kPointOrientationStr)
+            .Build());
+    result.push_back(
+        ContentHashBuilder(PrimvarLocator(HdInstancerTokens->scale))
+            .AddKey(GetPointCount(object))
+            .AddSampledArray<Bifrost::Math::float3>(object, motionSamples,
+                                                    kPointScaleStr)
+            .AddSampledArray<Amino::float_t>(object, motionSamples,
+                                             kPointSizeStr)
+            .Build());
+    return result;
+}
 
+ContentHashes HashHdSceneIndexPrototype(const Bifrost::Object& object,
+                                        const SdfPath&         instancerPath) {
+    ContentHashes result;
+    switch (GetGeoType(object)) {
+        case BifrostHdGeoTypes::Mesh:
+            result = HashHdSceneIndexMesh(object);
+            break;
+        case BifrostHdGeoTypes::Strands:
+            result = HashHdSceneIndexBasisCurves(object);
+            break;
+        default: return result;
+    }
+    result.push_back(
+        ContentHashBuilder(HdInstancedBySchema::GetDefaultLocator())
+            .AddKey(instancerPath)
+            .Build());
     return result;
 }
 
@@ -616,7 +1168,7 @@ Amino::Ptr<Bifrost::Object> CreateBifrostMesh(const HdSceneIndexPrim& prim) {
     auto primvarsSchema = HdPrimvarsSchema::GetFromParent(prim.dataSource);
 
     // Create "point_position" Bifrost array from Hydra "points" primvar
-    Amino::MutablePtr<BifrostFloat3Array> positions;
+    Amino::Ptr<BifrostFloat3Array> positions;
     if (auto ptsDs = primvarsSchema.GetPrimvar(HdPrimvarsSchemaTokens->points)
                          .GetPrimvarValue()) {
         auto ptsValue = ptsDs->GetValue(0.0f);
@@ -624,13 +1176,8 @@ Amino::Ptr<Bifrost::Object> CreateBifrostMesh(const HdSceneIndexPrim& prim) {
             std::cerr << "Couldn't get Usd mesh points" << std::endl;
             return mesh.toImmutable();
         }
-
-        const auto& pts = ptsValue.UncheckedGet<VtArray<GfVec3f>>();
-        positions       = Amino::newMutablePtr<BifrostFloat3Array>(pts.size());
-        for (size_t i = 0; i < pts.size(); ++i) {
-            (*positions)[i] =
-                Bifrost::Math::float3{pts[i][0], pts[i][1], pts[i][2]};
-        }
+        positions = CopyToAminoArray<Bifrost::Math::float3>(
+            ptsValue.UncheckedGet<VtArray<GfVec3f>>());
     }
 
     // Create Bifrost "face data" from Hydra mesh topology
@@ -647,51 +1194,49 @@ Amino::Ptr<Bifrost::Object> CreateBifrostMesh(const HdSceneIndexPrim& prim) {
         return mesh.toImmutable();
     }
 
-    Amino::MutablePtr<BifrostGeoIndices> faceVertices;
     auto fvi = hdMeshTopo.GetFaceVertexIndices();
     if (!fvi) {
         std::cerr << "Couldn't get Usd mesh faceVertexIndices" << std::endl;
         return mesh.toImmutable();
     }
+    auto faceVertices =
+        CopyToAminoArray<Bifrost::Geometry::Index>(fvi->GetTypedValue(0.0f));
 
-    auto fviValue = fvi->GetTypedValue(0.0f);
-    faceVertices  = Amino::newMutablePtr<BifrostGeoIndices>(fviValue.size());
-
-    for (size_t i = 0; i < fviValue.size(); ++i) {
-        (*faceVertices)[i] = fviValue[i];
-    }
-
-    Amino::MutablePtr<BifrostGeoIndices> faceOffsets;
-    auto                                 fvc = hdMeshTopo.GetFaceVertexCounts();
+    auto fvc = hdMeshTopo.GetFaceVertexCounts();
     if (!fvc) {
         std::cerr << "couldn't get faceVertexCounts" << std::endl;
         return mesh.toImmutable();
     }
+    auto faceOffsets = UsdVertexCountToBifrostOffsets(fvc->GetTypedValue(0.0f));
 
-    auto   fvcValue       = fvc->GetTypedValue(0.0f);
-    size_t faceOffsetsCnt = fvcValue.size() + 1;
-
-    faceOffsets = Amino::newMutablePtr<BifrostGeoIndices>(faceOffsetsCnt);
-
-    for (size_t i = 0; i < faceOffsetsCnt; ++i) {
-        if (i == 0) {
-            (*faceOffsets)[0] = 0;
-        } else {
-            (*faceOffsets)[i] = fvcValue[i - 1] + (*faceOffsets)[i - 1];
-        }
-    }
-
-    Bifrost::Geometry::populateMesh(positions.toImmutable(),
-                             faceVertices.toImmutable(),
-                             faceOffsets.toImmutable(), *mesh);
+    Bifrost::Geometry::populateMesh(positions, faceVertices, faceOffsets,
+                                    *mesh);
 
+    // Each primvar is read once. The points are already the positions.
     for (const auto& name : primvarsSchema.GetPrimvarNames()) {
-        bool status =
-            AddScalarArrayToMesh<float>(name.GetText(), primvarsSchema, *mesh);
-
-        if (!status) {
-            AddVec3ArrayToMesh<GfVec3f, Bifrost::Math::float3>(
-                name.GetText(), primvarsSchema, mesh);
+        const Amino::String bifrostName{name.GetText()};
+        if (name == HdPrimvarsSchemaTokens->points) {
+            AddPointDataToMesh(bifrostName, positions, *mesh);
+            continue;
+        }
+        auto dataSource = primvarsSchema.GetPrimvar(name).GetPrimvarValue();
+        if (!dataSource) {
+            continue;
+        }
+        const auto value = dataSource->GetValue(0.0f);
+        if (value.IsHolding<VtFloatArray>()) {
+            const auto& data = value.UncheckedGet<VtFloatArray>();
+            if (!data.empty()) {
+                AddPointDataToMesh(bifrostName,
+                                   CopyToAminoArray<float>(data), *mesh);
+            }
+        } else if (value.IsHolding<VtVec3fArray>()) {
+            const auto& data = value.UncheckedGet<VtVec3fArray>();
+            if (!data.empty()) {
+                AddPointDataToMesh(
+                    bifrostName,
+                    CopyToAminoArray<Bifrost::Math::float3>(data), *mesh);
+            }
         }
     }
 
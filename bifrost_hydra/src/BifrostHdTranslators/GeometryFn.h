@@ -20,11 +20,15 @@
 #define BIFROST_HD_GRAPH_GEOMETRY_FN_H
 
 #include <BifrostHydra/Translators/Export.h>
+#include <BifrostHydra/Translators/Geometry.h>
 
 #include <Bifrost/Object/Object.h>
 
+#include <pxr/base/gf/quatf.h>
 #include <pxr/imaging/hd/sceneIndex.h>
 
+#include <vector>
+
 enum class BifrostHdGeoTypes {
     Empty,
     Mesh,
@@ -60,6 +64,15 @@ PXR_NS::VtInt64Array GetPointIDs(const Bifrost::Object& object);
 BIFROST_HD_TRANSLATORS_SHARED_DECL
 PXR_NS::VtInt64Array GetPointInstanceIDs(const Bifrost::Object& object);
 
+// The orientations of the instances, identity if the object has none.
+BIFROST_HD_TRANSLATORS_SHARED_DECL
+PXR_NS::VtQuatfArray GetOrientations(const Bifrost::Object& object);
+
+// The scales of the instances: their point_scale multiplied by their
+// point_size, one if the object has neither.
+BIFROST_HD_TRANSLATORS_SHARED_DECL
+PXR_NS::VtVec3fArray GetScales(const Bifrost::Object& object);
+
 BIFROST_HD_TRANSLATORS_SHARED_DECL
 Amino::Ptr<Bifrost::Object> GetInstanceShape(const Bifrost::Object& object);
 
@@ -70,17 +83,72 @@ Amino::Ptr<Bifrost::Object> GetShapeFromId(const Bifrost::Object& object,
 BIFROST_HD_TRANSLATORS_SHARED_DECL
 Amino::Ptr<Bifrost::Object> GetRenderGeometry(const Bifrost::Object& object);
 
+/// The prototypes of an instancer.
+struct InstancerPrototypes {
+    /// The paths of the prototype prims.
+    PXR_NS::VtArray<PXR_NS::SdfPath> paths;
+    /// The index in paths of the prototype of each shape id of the instances.
+    /// Instances of a shape mapped to -1, or whose shape id has no entry, are
+    /// not drawn. If empty, there are no prototypes and no instance is drawn.
+    std::vector<int> shapePrototypes;
+};
+
 // Bifrost to Hydra translators
+// The data of the object is converted only when the render delegates ask for
+// it, the returned prims keep the object alive until then.
+// The positions of the given motion samples are interpolated to motion blur
+// the prims. Samples with a different number of points are ignored.
 BIFROST_HD_TRANSLATORS_SHARED_DECL
-PXR_NS::HdSceneIndexPrim CreateHdSceneIndexMesh(const Bifrost::Object& object);
+PXR_NS::HdSceneIndexPrim CreateHdSceneIndexMesh(
+    const Amino::Ptr<Bifrost::Object>& object,
+    const MotionSamples&               motionSamples = {});
 
 BIFROST_HD_TRANSLATORS_SHARED_DECL
 PXR_NS::HdSceneIndexPrim CreateHdSceneIndexBasisCurves(
-    const Bifrost::Object& object);
+    const Amino::Ptr<Bifrost::Object>& object,
+    const MotionSamples&               motionSamples = {});
+
+BIFROST_HD_TRANSLATORS_SHARED_DECL
+PXR_NS::HdSceneIndexPrim CreateHdSceneIndexPoints(
+    const Amino::Ptr<Bifrost::Object>& object,
+    const MotionSamples&               motionSamples = {});
 
 BIFROST_HD_TRANSLATORS_SHARED_DECL
 PXR_NS::HdSceneIndexPrim CreateHdSceneIndexExplicitInstancer(
-    const Bifrost::Object& object);
+    const Amino::Ptr<Bifrost::Object>& object,
+    const InstancerPrototypes&         prototypes    = {},
+    const MotionSamples&               motionSamples = {});
+
+// Prototype of the given instancer, translating the render geometry of an
+// instance shape. Returns an empty prim if the geometry is not supported.
+BIFROST_HD_TRANSLATORS_SHARED_DECL
+PXR_NS::HdSceneIndexPrim CreateHdSceneIndexPrototype(
+    const Amino::Ptr<Bifrost::Object>& object,
+    const PXR_NS::SdfPath&             instancerPath);
+
+// Hashes of the data of the prims translated by the functions above, see
+// Geometry::getDirtiedLocators().
+BIFROST_HD_TRANSLATORS_SHARED_DECL
+ContentHashes HashHdSceneIndexMesh(const Bifrost::Object& object,
+                                   const MotionSamples&   motionSamples = {});
+
+BIFROST_HD_TRANSLATORS_SHARED_DECL
+ContentHashes HashHdSceneIndexBasisCurves(
+    const Bifrost::Object& object, const MotionSamples& motionSamples = {});
+
+BIFROST_HD_TRANSLATORS_SHARED_DECL
+ContentHashes HashHdSceneIndexPoints(const Bifrost::Object& object,
+                                     const MotionSamples&   motionSamples = {});
+
+BIFROST_HD_TRANSLATORS_SHARED_DECL
+ContentHashes HashHdSceneIndexExplicitInstancer(
+    const Bifrost::Object&     object,
+    const InstancerPrototypes& prototypes    = {},
+    const MotionSamples&       motionSamples = {});
+
+BIFROST_HD_TRANSLATORS_SHARED_DECL
+ContentHashes HashHdSceneIndexPrototype(const Bifrost::Object& object,
+                                        const PXR_NS::SdfPath& instancerPath);
 
 // Hydra to Bifrost translators
 
@@ -19,31 +19,74 @@
 
 #include <pxr/imaging/hd/instancerTopologySchema.h>
 
+#include <algorithm>
+#include <string>
+#include <vector>
+
 PXR_NAMESPACE_USING_DIRECTIVE
 
 namespace {} // namespace
 
 namespace BifrostHd {
 
-Instances::Instances(const Bifrost::Object& object) {
-    m_children_map[PXR_NS::SdfPath{"instancer"}] =
-        CreateHdSceneIndexExplicitInstancer(object);
-
-    auto instanceShape = BifrostHd::GetInstanceShape(object);
-    if (instanceShape) {
-        const auto vtPointInstanceIDs = BifrostHd::GetPointInstanceIDs(object);
-        if (!vtPointInstanceIDs.empty()) {
-            auto shapeID = vtPointInstanceIDs[0];
-            auto shape   = BifrostHd::GetShapeFromId(*instanceShape, shapeID);
-            if (shape) {
-                auto renderGeometry = BifrostHd::GetRenderGeometry(*shape);
-                if (renderGeometry) {
-                    m_children_map[PXR_NS::SdfPath{"proto0_mesh_id0"}] =
-                        CreateHdSceneIndexMesh(*renderGeometry);
-                }
+Instances::Instances(const Amino::Ptr<Bifrost::Object>& object,
+                     const PXR_NS::SdfPath&             parentPath,
+                     const size_t                       index,
+                     const MotionSamples&               motionSamples) {
+    const PXR_NS::SdfPath instancerName{std::string{"instancer"} +
+                                        std::to_string(index)};
+    const auto instancerPath = parentPath.AppendPath(instancerName);
+
+    // Each distinct render geometry is translated once, for all the shapes
+    // and the instances using it.
+    InstancerPrototypes prototypes;
+    std::vector<const Bifrost::Object*> prototypeGeometries;
+    if (auto instanceShape = BifrostHd::GetInstanceShape(*object)) {
+        for (Amino::long_t shapeID = 0;; ++shapeID) {
+            auto shape = BifrostHd::GetShapeFromId(*instanceShape, shapeID);
+            if (!shape) {
+                break;
+            }
+            auto renderGeometry = BifrostHd::GetRenderGeometry(*shape);
+            if (!renderGeometry) {
+                renderGeometry = shape;
+            }
+
+            const auto found =
+                std::find(prototypeGeometries.begin(),
+                          prototypeGeometries.end(), renderGeometry.get());
+            if (found != prototypeGeometries.end()) {
+                prototypes.shapePrototypes.push_back(
+                    static_cast<int>(found - prototypeGeometries.begin()));
+                continue;
             }
+
+            auto prim =
+                BifrostHd::CreateHdSceneIndexPrototype(renderGeometry,
+                                                       instancerPath);
+            if (!prim.dataSource) {
+                prototypes.shapePrototypes.push_back(-1);
+                continue;
+            }
+
+            const auto protoName = instancerName.AppendChild(PXR_NS::TfToken{
+                "proto" + std::to_string(prototypeGeometries.size())});
+            prototypes.shapePrototypes.push_back(
+                static_cast<int>(prototypeGeometries.size()));
+            prototypes.paths.push_back(parentPath.AppendPath(protoName));
+            prototypeGeometries.push_back(renderGeometry.get());
+
+            m_children_map[protoName] = std::move(prim);
+            m_content_hashes[protoName] =
+                BifrostHd::HashHdSceneIndexPrototype(*renderGeometry,
+                                                     instancerPath);
         }
     }
+
+    m_children_map[instancerName] = CreateHdSceneIndexExplicitInstancer(
+        object, prototypes, motionSamples);
+    m_content_hashes[instancerName] =
+        HashHdSceneIndexExplicitInstancer(*object, prototypes, motionSamples);
 }
 
 const TfToken& Instances::getSceneIndexPrimTypeName() const {
@@ -23,7 +23,19 @@ namespace BifrostHd {
 
 class BIFROST_HD_TRANSLATORS_SHARED_DECL Instances : public Geometry {
 public:
-    explicit Instances(const Bifrost::Object& object);
+    /// The children are an instancer, named "instancer<index>", and its
+    /// prototypes, named "instancer<index>/proto<n>", one for each distinct
+    /// render geometry of the instance shapes.
+    /// \param [in] object The Bifrost instances.
+    /// \param [in] parentPath The path of the prim under which the children
+    ///            are created, needed by the instancer to refer to its
+    ///            prototypes.
+    /// \param [in] index The index of the object in the graph output.
+    /// \param [in] motionSamples The object at other shutter offsets.
+    explicit Instances(const Amino::Ptr<Bifrost::Object>& object,
+                       const PXR_NS::SdfPath&             parentPath,
+                       const size_t                       index = 0,
+                       const MotionSamples&               motionSamples = {});
 
     const PXR_NS::TfToken& getSceneIndexPrimTypeName() const override;
 
@@ -26,9 +26,14 @@ namespace {} // namespace
 
 namespace BifrostHd {
 
-Mesh::Mesh(const Bifrost::Object& object, const size_t index) {
+Mesh::Mesh(const Amino::Ptr<Bifrost::Object>& object,
+           const size_t                       index,
+           const MotionSamples&               motionSamples) {
     const auto name = std::string{"mesh"} + std::to_string(index);
-    m_children_map[PXR_NS::SdfPath{name}] = CreateHdSceneIndexMesh(object);
+    m_children_map[PXR_NS::SdfPath{name}] =
+        CreateHdSceneIndexMesh(object, motionSamples);
+    m_content_hashes[PXR_NS::SdfPath{name}] =
+        HashHdSceneIndexMesh(*object, motionSamples);
 }
 
 const PXR_NS::TfToken& Mesh::getSceneIndexPrimTypeName() const {
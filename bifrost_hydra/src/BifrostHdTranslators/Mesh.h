@@ -24,7 +24,9 @@ namespace BifrostHd {
 
 class BIFROST_HD_TRANSLATORS_SHARED_DECL Mesh : public Geometry {
 public:
-    explicit Mesh(const Bifrost::Object& object, const size_t index=0);
+    explicit Mesh(const Amino::Ptr<Bifrost::Object>& object,
+                  const size_t                       index         = 0,
+                  const MotionSamples&               motionSamples = {});
 
     const PXR_NS::TfToken& getSceneIndexPrimTypeName() const override;
 
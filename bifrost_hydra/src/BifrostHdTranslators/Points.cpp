@@ -0,0 +1,49 @@
+//-
+// Copyright 2023 Autodesk, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//+
+
+#include <BifrostHydra/Translators/GeometryFn.h>
+#include <BifrostHydra/Translators/Points.h>
+
+#include <pxr/imaging/hd/primvarsSchema.h>
+#include <pxr/imaging/hd/tokens.h>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+namespace {} // namespace
+
+namespace BifrostHd {
+
+Points::Points(const Amino::Ptr<Bifrost::Object>& object,
+               const size_t                       index,
+               const MotionSamples&               motionSamples) {
+    const auto name = std::string{"points"} + std::to_string(index);
+    m_children_map[PXR_NS::SdfPath{name}] =
+        CreateHdSceneIndexPoints(object, motionSamples);
+    m_content_hashes[PXR_NS::SdfPath{name}] =
+        HashHdSceneIndexPoints(*object, motionSamples);
+}
+
+const PXR_NS::TfToken& Points::getSceneIndexPrimTypeName() const {
+    return HdPrimTypeTokens->points;
+}
+
+const PXR_NS::HdDataSourceLocator& Points::TopologyLocator() const {
+    return HdPrimvarsSchema::GetPointsLocator();
+}
+
+const ChildPrimMap& Points::getChildren() const { return m_children_map; }
+
+} // namespace BifrostHd
@@ -26,10 +26,14 @@ namespace {} // namespace
 
 namespace BifrostHd {
 
-Strands::Strands(const Bifrost::Object& object, const size_t index) {
+Strands::Strands(const Amino::Ptr<Bifrost::Object>& object,
+                 const size_t                       index,
+                 const MotionSamples&               motionSamples) {
     const auto name = std::string{"curves"} + std::to_string(index);
     m_children_map[PXR_NS::SdfPath{name}] =
-        CreateHdSceneIndexBasisCurves(object);
+        CreateHdSceneIndexBasisCurves(object, motionSamples);
+    m_content_hashes[PXR_NS::SdfPath{name}] =
+        HashHdSceneIndexBasisCurves(*object, motionSamples);
 }
 
 const PXR_NS::TfToken& Strands::getSceneIndexPrimTypeName() const {
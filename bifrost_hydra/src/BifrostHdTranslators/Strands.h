@@ -24,7 +24,9 @@ namespace BifrostHd {
 
 class BIFROST_HD_TRANSLATORS_SHARED_DECL Strands : public Geometry {
 public:
-    explicit Strands(const Bifrost::Object& object, const size_t index=0);
+    explicit Strands(const Amino::Ptr<Bifrost::Object>& object,
+                     const size_t                       index         = 0,
+                     const MotionSamples&               motionSamples = {});
 
     const PXR_NS::TfToken& getSceneIndexPrimTypeName() const override;
 
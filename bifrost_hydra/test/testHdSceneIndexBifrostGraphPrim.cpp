@@ -19,6 +19,8 @@
 #include "testUtils/TestSceneIndexPrim.h"
 
 // Bifrost
+#include <Bifrost/Geometry/GeoProperty.h>
+#include <Bifrost/Geometry/Primitives.h>
 #include <Bifrost/Object/Object.h>
 
 // Bifrost USD
@@ -33,12 +35,25 @@
 #include <BifrostHydra/Translators/GeometryFn.h>
 #include <BifrostHydra/Translators/Instances.h>
 #include <BifrostHydra/Translators/Mesh.h>
+#include <BifrostHydra/Translators/Points.h>
 
 // Pixar USD
+#include <pxr/imaging/hd/instancedBySchema.h>
+#include <pxr/imaging/hd/instancerTopologySchema.h>
 #include <pxr/imaging/hd/meshSchema.h>
 #include <pxr/imaging/hd/primvarsSchema.h>
+#include <pxr/imaging/hd/retainedDataSource.h>
+#include <pxr/usd/sdf/types.h>
 #include <pxr/usd/usd/prim.h>
 #include <pxr/usd/usdGeom/primvarsAPI.h>
+#if PXR_VERSION >= 2308
+#include <pxr/imaging/hd/sceneIndexPluginRegistry.h>
+#include <pxr/imaging/hd/systemMessages.h>
+#endif
+
+#include <chrono>
+#include <thread>
+#include <vector>
 
 
 PXR_NAMESPACE_USING_DIRECTIVE
@@ -75,6 +90,47 @@ TEST_F(TestSceneIndexPrim, runtime) {
         nodeDefs.findByName("Hydra::Testing::simple_add", simpleAddNodeDef));
 }
 
+TEST_F(TestSceneIndexPrim, runtime_containers) {
+    auto& runtime = BifrostHd::Runtime::getInstance();
+
+    const std::string compoundName{"Hydra::Testing::simple_add"};
+    BifrostHd::Container* compiled = nullptr;
+    {
+        auto container = runtime.acquireContainer(compoundName);
+        ASSERT_TRUE(container);
+        compiled = container.get();
+
+        // Lent containers are not shared.
+        auto other = runtime.acquireContainer(compoundName);
+        ASSERT_TRUE(other);
+        EXPECT_NE(other.get(), compiled);
+    }
+
+    // Given back containers are reused instead of being compiled again.
+    auto container = runtime.acquireContainer(compoundName);
+    EXPECT_EQ(container.get(), compiled);
+
+    // Containers acquired concurrently are compiled one at a time.
+    std::vector<BifrostHd::ContainerLease> leases(4);
+    std::vector<std::thread>               threads;
+    for (size_t i = 0; i < leases.size(); ++i) {
+        threads.emplace_back([&runtime, &leases, &compoundName, i]() {
+            leases[i] = runtime.acquireContainer(compoundName);
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    for (const auto& lease : leases) {
+        EXPECT_TRUE(lease);
+    }
+
+    // Compounds that fail are not loaded again.
+    const std::string missingName{"Hydra::Testing::does_not_exist"};
+    EXPECT_FALSE(runtime.acquireContainer(missingName));
+    EXPECT_FALSE(runtime.acquireContainer(missingName));
+}
+
 TEST_F(TestSceneIndexPrim, parameters) {
     // open stage
     std::string stageFilePath =
@@ -114,6 +170,116 @@ TEST_F(TestSceneIndexPrim, parameters) {
     EXPECT_TRUE(objectArray.empty());
 }
 
+TEST_F(TestSceneIndexPrim, parameters_changes) {
+    std::string stageFilePath =
+        BifrostUsd::TestUtils::getResourcePath("create_strands_test1.usda")
+            .c_str();
+
+    auto stage = openStage(stageFilePath);
+    ASSERT_TRUE(stage);
+    ASSERT_TRUE(render());
+    auto primPath = SdfPath{"/Asset/BifrostGraph"};
+
+    BifrostHd::Parameters hdParams;
+    EXPECT_TRUE(hdParams.setInputs(getHdPrim(primPath)));
+    // Same inputs: the graph does not need to be executed again.
+    EXPECT_FALSE(hdParams.setInputs(getHdPrim(primPath)));
+
+    auto primvar = PXR_NS::UsdGeomPrimvarsAPI(stage->GetPrimAtPath(primPath))
+                       .GetPrimvar(PXR_NS::TfToken{"strands_length"});
+    ASSERT_TRUE(primvar);
+    primvar.Set(2.f);
+    reRender();
+
+    EXPECT_TRUE(hdParams.setInputs(getHdPrim(primPath)));
+    EXPECT_FALSE(hdParams.setInputs(getHdPrim(primPath)));
+    EXPECT_EQ(hdParams.inputs().at("strands_length").Get<float>(), 2.f);
+}
+
+TEST_F(TestSceneIndexPrim, parameters_dirtied_primvars) {
+    std::string stageFilePath =
+        BifrostUsd::TestUtils::getResourcePath("create_strands_test1.usda")
+            .c_str();
+
+    auto stage = openStage(stageFilePath);
+    ASSERT_TRUE(stage);
+    ASSERT_TRUE(render());
+    auto primPath = SdfPath{"/Asset/BifrostGraph"};
+
+    BifrostHd::Parameters hdParams;
+    EXPECT_TRUE(hdParams.setInputs(getHdPrim(primPath)));
+
+    auto primvar = PXR_NS::UsdGeomPrimvarsAPI(stage->GetPrimAtPath(primPath))
+                       .GetPrimvar(PXR_NS::TfToken{"strands_length"});
+    ASSERT_TRUE(primvar);
+    primvar.Set(2.f);
+    reRender();
+
+    // Only the dirtied primvars are read again.
+    const HdDataSourceLocatorSet otherLocators{
+        HdPrimvarsSchema::GetDefaultLocator().Append(TfToken{"other"})};
+    EXPECT_FALSE(hdParams.setInputs(getHdPrim(primPath), &otherLocators));
+    EXPECT_NE(hdParams.inputs().at("strands_length").Get<float>(), 2.f);
+
+    const HdDataSourceLocatorSet lengthLocators{
+        HdPrimvarsSchema::GetDefaultLocator().Append(
+            TfToken{"strands_length"})};
+    EXPECT_TRUE(hdParams.setInputs(getHdPrim(primPath), &lengthLocators));
+    EXPECT_EQ(hdParams.inputs().at("strands_length").Get<float>(), 2.f);
+
+    // The inputs of the ports are found by port index.
+    const std::vector<std::string> portNames{"strands_length", "missing"};
+    hdParams.bindPorts(portNames);
+    ASSERT_NE(hdParams.portInput(0), nullptr);
+    EXPECT_EQ(hdParams.portInput(0)->Get<float>(), 2.f);
+    EXPECT_EQ(hdParams.portInput(1), nullptr);
+    EXPECT_EQ(hdParams.portInput(2), nullptr);
+
+    primvar.Set(3.f);
+    reRender();
+    EXPECT_TRUE(hdParams.setInputs(getHdPrim(primPath), &lengthLocators));
+    hdParams.bindPorts(portNames);
+    EXPECT_EQ(hdParams.portInput(0)->Get<float>(), 3.f);
+}
+
+TEST_F(TestSceneIndexPrim, parameters_frame) {
+    std::string stageFilePath =
+        BifrostUsd::TestUtils::getResourcePath("create_strands_test1.usda")
+            .c_str();
+
+    auto stage = openStage(stageFilePath);
+    ASSERT_TRUE(stage);
+    ASSERT_TRUE(render());
+    auto primPath = SdfPath{"/Asset/BifrostGraph"};
+
+    BifrostHd::Parameters hdParams;
+    EXPECT_TRUE(hdParams.setInputs(getHdPrim(primPath)));
+    EXPECT_EQ(hdParams.frame(), 0.0);
+    const auto hash = hdParams.inputsHash();
+
+    auto primvar = PXR_NS::UsdGeomPrimvarsAPI(stage->GetPrimAtPath(primPath))
+                       .CreatePrimvar(PXR_NS::TfToken{"bifrost:frame"},
+                                      PXR_NS::SdfValueTypeNames->Double);
+    ASSERT_TRUE(primvar);
+    primvar.Set(12.0);
+    reRender();
+
+    // A new frame must be executed, but the inputs of the graph are the same.
+    EXPECT_TRUE(hdParams.setInputs(getHdPrim(primPath)));
+    EXPECT_EQ(hdParams.frame(), 12.0);
+    EXPECT_EQ(hdParams.inputsHash(), hash);
+
+    auto lengthPrimvar =
+        PXR_NS::UsdGeomPrimvarsAPI(stage->GetPrimAtPath(primPath))
+            .GetPrimvar(PXR_NS::TfToken{"strands_length"});
+    ASSERT_TRUE(lengthPrimvar);
+    lengthPrimvar.Set(3.f);
+    reRender();
+
+    EXPECT_TRUE(hdParams.setInputs(getHdPrim(primPath)));
+    EXPECT_NE(hdParams.inputsHash(), hash);
+}
+
 TEST_F(TestSceneIndexPrim, create_mesh_cube) {
     // open stage
     std::string stageFilePath =
@@ -148,7 +314,7 @@ TEST_F(TestSceneIndexPrim, create_mesh_cube) {
     EXPECT_TRUE(vtDisplayColor.empty());
 
     // Test on BifrostTranslators::Mesh
-    BifrostHd::Mesh mesh(*outputGeo);
+    BifrostHd::Mesh mesh(outputGeo);
 
     const auto& children = mesh.getChildren();
     const auto  it       = children.find(SdfPath{"mesh0"});
@@ -158,7 +324,7 @@ TEST_F(TestSceneIndexPrim, create_mesh_cube) {
     EXPECT_EQ(hdPrim.primType, HdPrimTypeTokens->mesh);
 
     // Tests on the Hydra scene index prim
-    auto hdMeshPrim = BifrostHd::CreateHdSceneIndexMesh(*outputGeo);
+    auto hdMeshPrim = BifrostHd::CreateHdSceneIndexMesh(outputGeo);
     TestHdSceneIndexMesh(hdMeshPrim, /*hasDisplayColor*/false);
 }
 
@@ -218,7 +384,7 @@ TEST_F(TestSceneIndexPrim, create_colored_mesh_cube) {
     EXPECT_EQ(vtDisplayColor.size(), 8);
 
     // Test on BiforstTranslators::Mesh
-    BifrostHd::Mesh mesh(*object);
+    BifrostHd::Mesh mesh(object);
 
     const auto& children = mesh.getChildren();
     const auto  it       = children.find(SdfPath{"mesh0"});
@@ -228,12 +394,20 @@ TEST_F(TestSceneIndexPrim, create_colored_mesh_cube) {
     EXPECT_EQ(hdPrim.primType, HdPrimTypeTokens->mesh);
 
     // Tests on the Hydra scene index prim
-    auto hdMeshPrim = BifrostHd::CreateHdSceneIndexMesh(*object);
+    auto hdMeshPrim = BifrostHd::CreateHdSceneIndexMesh(object);
     TestHdSceneIndexMesh(hdMeshPrim);
+
+    // The data sources are built when first asked for, then reused.
+    EXPECT_EQ(hdMeshPrim.dataSource->Get(HdPrimvarsSchemaTokens->primvars),
+              hdMeshPrim.dataSource->Get(HdPrimvarsSchemaTokens->primvars));
+    auto primvars =
+        HdPrimvarsSchema::GetFromParent(hdMeshPrim.dataSource).GetContainer();
+    ASSERT_TRUE(primvars);
+    EXPECT_EQ(primvars->Get(HdTokens->displayColor),
+              primvars->Get(HdTokens->displayColor));
+    EXPECT_FALSE(primvars->Get(HdTokens->widths));
 }
 
-// TODO(laforgg): Implement Instancing. Currenyly it is broken.
-#if 0
 TEST_F(TestSceneIndexPrim, create_simple_instances_test) {
     // open stage
     std::string stageFilePath = BifrostUsd::TestUtils::getResourcePath(
@@ -246,14 +420,29 @@ TEST_F(TestSceneIndexPrim, create_simple_instances_test) {
     EXPECT_EQ(graphPrim.primType, TfToken{"resolvedHydraGenerativeProcedural"});
     auto childrenPaths =
         sceneIndex->GetChildPrimPaths(SdfPath{"/Asset/BifrostGraph"});
-    EXPECT_EQ(childrenPaths.size(), 1);
-    EXPECT_EQ(childrenPaths[0], SdfPath{"/Asset/BifrostGraph/instancer"});
-
-    auto protoPaths =
-        sceneIndex->GetChildPrimPaths(SdfPath{"/Asset/BifrostGraph/instancer"});
-    EXPECT_EQ(protoPaths.size(), 1);
-    EXPECT_EQ(protoPaths[0],
-              SdfPath{"/Asset/BifrostGraph/instancer/prototypes"});
+    ASSERT_EQ(childrenPaths.size(), 1);
+    const SdfPath instancerPath{"/Asset/BifrostGraph/instancer0"};
+    EXPECT_EQ(childrenPaths[0], instancerPath);
+    EXPECT_EQ(getHdPrim(instancerPath).primType, HdPrimTypeTokens->instancer);
+
+    auto protoPaths = sceneIndex->GetChildPrimPaths(instancerPath);
+    ASSERT_EQ(protoPaths.size(), 1);
+    const SdfPath protoPath{"/Asset/BifrostGraph/instancer0/proto0"};
+    EXPECT_EQ(protoPaths[0], protoPath);
+
+    // The prototype is drawn by the instancer only.
+    auto hdProto = getHdPrim(protoPath);
+    EXPECT_EQ(hdProto.primType, HdPrimTypeTokens->mesh);
+    auto instancedBy = HdInstancedBySchema::GetFromParent(hdProto.dataSource);
+    ASSERT_TRUE(instancedBy.GetPaths());
+    EXPECT_EQ(instancedBy.GetPaths()->GetTypedValue(0.0f),
+              VtArray<SdfPath>{instancerPath});
+
+    auto topology = HdInstancerTopologySchema::GetFromParent(
+        getHdPrim(instancerPath).dataSource);
+    ASSERT_TRUE(topology.GetPrototypes());
+    EXPECT_EQ(topology.GetPrototypes()->GetTypedValue(0.0f),
+              VtArray<SdfPath>{protoPath});
 
     // ----------------------------------------------------------------------
 
@@ -297,12 +486,23 @@ TEST_F(TestSceneIndexPrim, create_simple_instances_test) {
     auto vtProtoPoints = BifrostHd::GetPoints(*renderGeometry);
     EXPECT_EQ(vtProtoPoints.size(), 8);
 
+    // Without orientations nor scales, the instances are not transformed.
+    EXPECT_EQ(BifrostHd::GetOrientations(*object),
+              VtQuatfArray(2, GfQuatf::GetIdentity()));
+    EXPECT_EQ(BifrostHd::GetScales(*object), VtVec3fArray(2, GfVec3f(1.0f)));
+
+    // Tests on the Bifrost Hydra translator
+    BifrostHd::Instances instances(object, SdfPath{"/Asset/BifrostGraph"});
+    const auto& children = instances.getChildren();
+    EXPECT_EQ(children.size(), 2);
+    EXPECT_TRUE(children.find(SdfPath{"instancer0"}) != children.end());
+    EXPECT_TRUE(children.find(SdfPath{"instancer0/proto0"}) != children.end());
+
     // Tests on the Hydra scene index prim
     auto hdInstancer =
-        BifrostHd::CreateHdSceneIndexExplicitInstancer(*object);
+        BifrostHd::CreateHdSceneIndexExplicitInstancer(object);
     EXPECT_EQ(hdInstancer.primType, HdPrimTypeTokens->instancer);
 }
-#endif
 
 TEST_F(TestSceneIndexPrim, create_strands_test1) {
     // open stage
@@ -342,7 +542,7 @@ TEST_F(TestSceneIndexPrim, create_strands_test1) {
 
     // Tests on the Hydra scene index prim
     auto hdBasisCurvesPrim =
-        BifrostHd::CreateHdSceneIndexBasisCurves(*object);
+        BifrostHd::CreateHdSceneIndexBasisCurves(object);
     TestHdSceneIndexBasisCurves(hdBasisCurvesPrim);
 }
 
@@ -388,6 +588,108 @@ TEST_F(TestSceneIndexPrim, create_mesh_plane_with_animated_pt) {
     }
 }
 
+TEST_F(TestSceneIndexPrim, output_buffers) {
+    std::string stageFilePath = BifrostUsd::TestUtils::getResourcePath(
+                                    "create_mesh_plane_with_animated_pt.usda")
+                                    .c_str();
+
+    ASSERT_TRUE(openStage(stageFilePath));
+    ASSERT_TRUE(render());
+
+    BifrostHd::Engine engine;
+    engine.setInputs(getHdPrim(SdfPath{"/Asset/BifrostGraph"}));
+    ASSERT_EQ(engine.execute(0.0), Amino::Job::State::kSuccess);
+    ASSERT_EQ(engine.output().second.size(), 1);
+    const auto previous = engine.output().second[0];
+
+    // Each execution replaces the output of the previous one, which stays
+    // valid for the translators still reading it.
+    ASSERT_EQ(engine.execute(24.0), Amino::Job::State::kSuccess);
+    ASSERT_EQ(engine.output().second.size(), 1);
+    EXPECT_FLOAT_EQ(BifrostHd::GetPoints(*engine.output().second[0])[0][1],
+                    24.5);
+    EXPECT_FLOAT_EQ(BifrostHd::GetPoints(*previous)[0][1], 0.5);
+
+    ASSERT_EQ(engine.execute(12.0), Amino::Job::State::kSuccess);
+    ASSERT_EQ(engine.output().second.size(), 1);
+    EXPECT_FLOAT_EQ(BifrostHd::GetPoints(*engine.output().second[0])[0][1],
+                    12.5);
+}
+
+TEST_F(TestSceneIndexPrim, create_mesh_plane_with_motion_samples) {
+    std::string stageFilePath = BifrostUsd::TestUtils::getResourcePath(
+                                    "create_mesh_plane_with_animated_pt.usda")
+                                    .c_str();
+
+    auto stage = openStage(stageFilePath);
+    ASSERT_TRUE(stage);
+    ASSERT_TRUE(render());
+    auto primPath = SdfPath{"/Asset/BifrostGraph"};
+
+    auto primvar = PXR_NS::UsdGeomPrimvarsAPI(stage->GetPrimAtPath(primPath))
+                       .CreatePrimvar(PXR_NS::TfToken{"bifrost:motionSamples"},
+                                      PXR_NS::SdfValueTypeNames->DoubleArray);
+    ASSERT_TRUE(primvar);
+    primvar.Set(PXR_NS::VtDoubleArray{-0.5, 0.0, 0.5});
+    reRender();
+
+    BifrostHd::Engine engine;
+    engine.setInputs(getHdPrim(primPath));
+    EXPECT_EQ(engine.shutterOffsets().size(), 3);
+
+    // The first point of the plane moves along the Y axis with the frame.
+    BifrostHd::MotionOutputs motionOutputs;
+    ASSERT_EQ(engine.executeMotionSamples(0.0, motionOutputs),
+              Amino::Job::State::kSuccess);
+    ASSERT_EQ(motionOutputs.size(), 2);
+    EXPECT_EQ(motionOutputs[0].first, -0.5);
+    EXPECT_EQ(motionOutputs[1].first, 0.5);
+
+    ASSERT_EQ(engine.execute(0.0), Amino::Job::State::kSuccess);
+    const auto& objectArray = engine.output().second;
+    ASSERT_EQ(objectArray.size(), 1);
+
+    BifrostHd::MotionSamples motionSamples;
+    for (const auto& motionOutput : motionOutputs) {
+        ASSERT_EQ(motionOutput.second.size(), 1);
+        motionSamples.push_back({static_cast<float>(motionOutput.first),
+                                 motionOutput.second[0]});
+    }
+
+    auto hdMesh = BifrostHd::CreateHdSceneIndexMesh(objectArray[0],
+                                                    motionSamples);
+    auto pointsDs =
+        PXR_NS::HdPrimvarsSchema::GetFromParent(hdMesh.dataSource)
+            .GetPrimvar(PXR_NS::HdPrimvarsSchemaTokens->points)
+            .GetPrimvarValue();
+    ASSERT_TRUE(pointsDs);
+
+    using Time = PXR_NS::HdSampledDataSource::Time;
+    std::vector<Time> sampleTimes;
+    EXPECT_TRUE(pointsDs->GetContributingSampleTimesForInterval(-0.5f, 0.5f,
+                                                                &sampleTimes));
+    EXPECT_EQ(sampleTimes, (std::vector<Time>{-0.5f, 0.0f, 0.5f}));
+
+    auto pointY = [&pointsDs](float shutterOffset) {
+        return pointsDs->GetValue(shutterOffset)
+            .UncheckedGet<PXR_NS::VtVec3fArray>()[0][1];
+    };
+    EXPECT_FLOAT_EQ(pointY(-0.5f), 0.0f);
+    EXPECT_FLOAT_EQ(pointY(0.0f), 0.5f);
+    EXPECT_FLOAT_EQ(pointY(0.25f), 0.75f);
+    EXPECT_FLOAT_EQ(pointY(0.5f), 1.0f);
+
+    // Without motion samples, the points do not vary over the shutter.
+    auto staticMesh = BifrostHd::CreateHdSceneIndexMesh(objectArray[0]);
+    auto staticPointsDs =
+        PXR_NS::HdPrimvarsSchema::GetFromParent(staticMesh.dataSource)
+            .GetPrimvar(PXR_NS::HdPrimvarsSchemaTokens->points)
+            .GetPrimvarValue();
+    ASSERT_TRUE(staticPointsDs);
+    EXPECT_FALSE(staticPointsDs->GetContributingSampleTimesForInterval(
+        -0.5f, 0.5f, &sampleTimes));
+}
+
 TEST_F(TestSceneIndexPrim, re_render) {
     // open stage
     std::string stageFilePath =
@@ -459,6 +761,95 @@ TEST_F(TestSceneIndexPrim, re_render) {
     // }
 }
 
+#if PXR_VERSION >= 2308
+TEST_F(TestSceneIndexPrim, async_execution) {
+    std::string stageFilePath =
+        BifrostUsd::TestUtils::getResourcePath("create_strands_test1.usda")
+            .c_str();
+    ASSERT_TRUE(openStage(stageFilePath));
+    const auto primPath = SdfPath{"/Asset/BifrostGraph"};
+
+    // The procedurals are executed asynchronously only if it is allowed
+    // before they are created, so before the first render.
+    engine.reset(new UsdImagingGLEngine(stage->GetPseudoRoot().GetPath(),
+                                        SdfPathVector{}));
+    const auto sceneIndexNames =
+        HdSceneIndexNameRegistry::GetInstance().GetRegisteredNames();
+    ASSERT_FALSE(sceneIndexNames.empty());
+    sceneIndex = HdSceneIndexNameRegistry::GetInstance().GetNamedSceneIndex(
+        sceneIndexNames[0]);
+    ASSERT_TRUE(sceneIndex);
+    sceneIndex->SystemMessage(HdSystemMessageTokens->asyncAllow, nullptr);
+
+    UsdImagingGLRenderParams params;
+    params.frame = 1;
+    auto renderWithLength = [&](float length) {
+        UsdGeomPrimvarsAPI(stage->GetPrimAtPath(primPath))
+            .GetPrimvar(TfToken{"strands_length"})
+            .Set(length);
+        engine->Render(stage->GetPseudoRoot(), params);
+    };
+
+    // The height of the last point of the strands is their length, -1 while
+    // there are no strands.
+    auto servedLength = [&]() {
+        const auto children = sceneIndex->GetChildPrimPaths(primPath);
+        if (children.empty()) return -1.f;
+        auto pointsDs =
+            HdPrimvarsSchema::GetFromParent(
+                sceneIndex->GetPrim(children[0]).dataSource)
+                .GetPrimvar(HdPrimvarsSchemaTokens->points)
+                .GetPrimvarValue();
+        if (!pointsDs) return -1.f;
+        const auto points = pointsDs->GetValue(0.0f).Get<VtVec3fArray>();
+        return points.size() == 18 ? points[17][1] : -1.f;
+    };
+
+    // Polls the procedural until it serves strands of the given length.
+    auto pollUntil = [&](float length) {
+        const auto timeout =
+            std::chrono::steady_clock::now() + std::chrono::minutes(1);
+        while (servedLength() != length &&
+               std::chrono::steady_clock::now() < timeout) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            sceneIndex->SystemMessage(HdSystemMessageTokens->asyncPoll,
+                                      nullptr);
+        }
+        return servedLength();
+    };
+
+    // Nothing is served until the first execution is over.
+    engine->Render(stage->GetPseudoRoot(), params);
+    EXPECT_EQ(servedLength(), -1.f);
+    EXPECT_EQ(pollUntil(1.f), 1.f);
+
+    // The previous children are served while the graph is executed again.
+    renderWithLength(2.f);
+    EXPECT_EQ(servedLength(), 1.f);
+
+    // An update received during the execution cancels it, the graph is
+    // executed again with the latest inputs once it is over.
+    renderWithLength(3.f);
+    EXPECT_EQ(servedLength(), 1.f);
+    EXPECT_EQ(pollUntil(3.f), 3.f);
+
+    // Inputs already executed are served from the cache, without waiting
+    // for an execution.
+    renderWithLength(1.f);
+    EXPECT_EQ(servedLength(), 1.f);
+
+    // Updates of data the graph does not read do not prevent its execution
+    // from being served.
+    renderWithLength(2.f);
+    UsdGeomPrimvarsAPI(stage->GetPrimAtPath(primPath))
+        .CreatePrimvar(TfToken{"unused"}, SdfValueTypeNames->Float)
+        .Set(1.f);
+    engine->Render(stage->GetPseudoRoot(), params);
+    EXPECT_EQ(servedLength(), 1.f);
+    EXPECT_EQ(pollUntil(2.f), 2.f);
+}
+#endif
+
 TEST_F(TestSceneIndexPrim, create_strands_from_input_mesh) {
     // open stage
     std::string stageFilePath =
@@ -469,3 +860,196 @@ TEST_F(TestSceneIndexPrim, create_strands_from_input_mesh) {
     ASSERT_TRUE(stage);
     ASSERT_TRUE(render());
 }
+
+namespace {
+Amino::Ptr<Bifrost::Object> CreatePointsMesh(const size_t pointCount,
+                                             const float  offset = 0.0f) {
+    auto positions =
+        Amino::newMutablePtr<Amino::Array<Bifrost::Math::float3>>(pointCount);
+    for (size_t i = 0; i < pointCount; ++i) {
+        const auto v    = static_cast<float>(i) + offset;
+        (*positions)[i] = Bifrost::Math::float3{v, v + 1, v + 2};
+    }
+    auto faceVertices =
+        Amino::newMutablePtr<Amino::Array<Bifrost::Geometry::Index>>();
+    auto faceOffsets =
+        Amino::newMutablePtr<Amino::Array<Bifrost::Geometry::Index>>(1);
+
+    auto mesh = Bifrost::createObject();
+    Bifrost::Geometry::populateMesh(positions.toImmutable(),
+                                    faceVertices.toImmutable(),
+                                    faceOffsets.toImmutable(), *mesh);
+    return mesh.toImmutable();
+}
+} // namespace
+
+TEST_F(TestSceneIndexPrim, zero_copy_arrays) {
+    VtVec3fArray vtPoints;
+    const void*  positionsData = nullptr;
+    {
+        auto mesh = CreatePointsMesh(10);
+        auto positions =
+            Bifrost::Geometry::getDataGeoPropValues<Bifrost::Math::float3>(
+                *mesh, Bifrost::Geometry::sPositions);
+        ASSERT_TRUE(positions);
+        positionsData = &(*positions)[0];
+
+        // The points alias the memory of the Bifrost positions.
+        vtPoints = BifrostHd::GetPoints(*mesh);
+        ASSERT_EQ(vtPoints.size(), 10);
+        EXPECT_EQ(static_cast<const void*>(vtPoints.cdata()), positionsData);
+        EXPECT_EQ(vtPoints[3], GfVec3f(3, 4, 5));
+    }
+
+    // The points keep the Bifrost positions alive.
+    EXPECT_EQ(static_cast<const void*>(vtPoints.cdata()), positionsData);
+    EXPECT_EQ(vtPoints[9], GfVec3f(9, 10, 11));
+
+    // Writing to the points copies them.
+    vtPoints[0] = GfVec3f(-1, -1, -1);
+    EXPECT_NE(static_cast<const void*>(vtPoints.cdata()), positionsData);
+    EXPECT_EQ(vtPoints[0], GfVec3f(-1, -1, -1));
+    EXPECT_EQ(vtPoints[9], GfVec3f(9, 10, 11));
+}
+
+TEST_F(TestSceneIndexPrim, dirtied_locators) {
+    const SdfPath   childName{"mesh0"};
+    BifrostHd::Mesh mesh(CreatePointsMesh(10));
+
+    // Same content: nothing to update.
+    BifrostHd::Mesh sameMesh(CreatePointsMesh(10));
+    EXPECT_TRUE(sameMesh.getDirtiedLocators(childName, mesh).IsEmpty());
+
+    // Moved points: only the points are dirtied, not the topology.
+    BifrostHd::Mesh movedMesh(CreatePointsMesh(10, 1.0f));
+    auto locators = movedMesh.getDirtiedLocators(childName, mesh);
+    EXPECT_TRUE(locators.Contains(HdPrimvarsSchema::GetPointsLocator()));
+    EXPECT_FALSE(locators.Intersects(HdMeshSchema::GetTopologyLocator()));
+
+    // Unknown child: the whole child is dirtied.
+    locators = movedMesh.getDirtiedLocators(SdfPath{"mesh1"}, mesh);
+    EXPECT_TRUE(locators.Contains(HdDataSourceLocator::EmptyLocator()));
+}
+
+TEST_F(TestSceneIndexPrim, content_hash) {
+    auto positions = Bifrost::Geometry::getDataGeoPropValues<
+        Bifrost::Math::float3>(*CreatePointsMesh(10),
+                               Bifrost::Geometry::sPositions);
+    auto hashContent = [](size_t hash) {
+        return [hash]() { return hash; };
+    };
+    auto failHashing = []() -> size_t {
+        ADD_FAILURE() << "The same arrays must not be hashed";
+        return 0;
+    };
+
+    BifrostHd::ContentHash hash{HdPrimvarsSchema::GetPointsLocator(), 1,
+                                {&*positions}, failHashing};
+    // The same arrays are not hashed.
+    EXPECT_TRUE(hash.isSame(hash));
+
+    // Other arrays are hashed.
+    BifrostHd::ContentHash other{HdPrimvarsSchema::GetPointsLocator(), 1,
+                                 {nullptr}, hashContent(2)};
+    hash.hashArrays = hashContent(2);
+    EXPECT_TRUE(hash.isSame(other));
+    other.hashArrays = hashContent(3);
+    EXPECT_FALSE(hash.isSame(other));
+
+    // The keys and locators are compared first.
+    other.hashArrays = failHashing;
+    other.key        = 2;
+    EXPECT_FALSE(hash.isSame(other));
+    other.key     = 1;
+    other.locator = HdMeshSchema::GetTopologyLocator();
+    EXPECT_FALSE(hash.isSame(other));
+}
+
+TEST_F(TestSceneIndexPrim, create_bifrost_mesh) {
+    // Enough faces for the offsets to be computed by several blocks.
+    constexpr size_t kFaceCount = 200000;
+    VtIntArray       counts(kFaceCount);
+    size_t           indexCount = 0;
+    for (size_t i = 0; i < kFaceCount; ++i) {
+        counts[i] = 3 + static_cast<int>(i % 2);
+        indexCount += counts[i];
+    }
+    VtIntArray indices(indexCount);
+    for (size_t i = 0; i < indexCount; ++i) {
+        indices[i] = static_cast<int>(i % 4);
+    }
+    VtVec3fArray points{GfVec3f(0, 0, 0), GfVec3f(1, 0, 0), GfVec3f(1, 1, 0),
+                        GfVec3f(0, 1, 0)};
+    VtFloatArray weights{0.0f, 0.5f, 1.0f, 1.5f};
+
+    auto primvar = [](const VtValue& value) {
+        return HdPrimvarSchema::Builder()
+            .SetPrimvarValue(HdRetainedSampledDataSource::New(value))
+            .SetInterpolation(HdPrimvarSchema::BuildInterpolationDataSource(
+                HdPrimvarSchemaTokens->vertex))
+            .Build();
+    };
+    HdSceneIndexPrim prim;
+    prim.primType   = HdPrimTypeTokens->mesh;
+    prim.dataSource = HdRetainedContainerDataSource::New(
+        HdMeshSchemaTokens->mesh,
+        HdMeshSchema::Builder()
+            .SetTopology(
+                HdMeshTopologySchema::Builder()
+                    .SetFaceVertexCounts(
+                        HdRetainedTypedSampledDataSource<VtIntArray>::New(
+                            counts))
+                    .SetFaceVertexIndices(
+                        HdRetainedTypedSampledDataSource<VtIntArray>::New(
+                            indices))
+                    .Build())
+            .Build(),
+        HdPrimvarsSchemaTokens->primvars,
+        HdRetainedContainerDataSource::New(
+            HdPrimvarsSchemaTokens->points, primvar(VtValue(points)),
+            TfToken{"weight"}, primvar(VtValue(weights))));
+
+    auto mesh = BifrostHd::CreateBifrostMesh(prim);
+    ASSERT_TRUE(mesh);
+    EXPECT_EQ(BifrostHd::GetPoints(*mesh), points);
+    EXPECT_EQ(BifrostHd::GetFaceVertexIndices(*mesh), indices);
+
+    auto offsets =
+        Bifrost::Geometry::getDataGeoPropValues<Bifrost::Geometry::Index>(
+            *mesh, Bifrost::Geometry::sFaceOffsets);
+    ASSERT_TRUE(offsets);
+    ASSERT_EQ(offsets->size(), kFaceCount + 1);
+    Bifrost::Geometry::Index offset = 0;
+    for (size_t i = 0; i < kFaceCount; ++i) {
+        ASSERT_EQ((*offsets)[i], offset);
+        offset += counts[i];
+    }
+    EXPECT_EQ((*offsets)[kFaceCount], indexCount);
+
+    auto meshWeights = Bifrost::Geometry::getDataGeoPropValues<float>(
+        *mesh, Amino::String{"weight"});
+    ASSERT_TRUE(meshWeights);
+    ASSERT_EQ(meshWeights->size(), weights.size());
+    EXPECT_EQ((*meshWeights)[3], 1.5f);
+}
+
+TEST_F(TestSceneIndexPrim, create_points) {
+    auto              points = CreatePointsMesh(10);
+    BifrostHd::Points translator(points, 2);
+
+    const auto& children = translator.getChildren();
+    const auto  it       = children.find(SdfPath{"points2"});
+    ASSERT_TRUE(it != children.end());
+    EXPECT_EQ(it->second.primType, HdPrimTypeTokens->points);
+
+    // The points alias the Bifrost positions, the render delegate defaults
+    // are used for the missing widths and colors.
+    auto primvars = HdPrimvarsSchema::GetFromParent(it->second.dataSource);
+    auto pointsValue =
+        primvars.GetPrimvar(HdPrimvarsSchemaTokens->points).GetPrimvarValue();
+    ASSERT_TRUE(pointsValue);
+    EXPECT_EQ(pointsValue->GetValue(0.0f).Get<VtVec3fArray>(),
+              BifrostHd::GetPoints(*points));
+    EXPECT_FALSE(primvars.GetPrimvar(HdTokens->widths).IsDefined());
+    EXPECT_FALSE(primvars.GetPrimvar(HdTokens->displayColor).IsDefined());
+}
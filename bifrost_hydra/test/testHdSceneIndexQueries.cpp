@@ -24,6 +24,10 @@
 // Pixar USD
 #include <pxr/imaging/hd/meshSchema.h>
 #include <pxr/imaging/hd/primvarsSchema.h>
+#include <pxr/imaging/hd/tokens.h>
+
+#include <algorithm>
+#include <string>
 
 PXR_NAMESPACE_USING_DIRECTIVE
 
@@ -90,6 +94,29 @@ TEST_F(TestSceneIndexPrim, create_colored_mesh_cube_query) {
     }
 }
 
+TEST_F(TestSceneIndexPrim, create_mesh_array_query) {
+    std::string stageFilePath =
+        BifrostUsd::TestUtils::getResourcePath("create_mesh_array.usda")
+            .c_str();
+
+    ASSERT_TRUE(openStage(stageFilePath));
+    ASSERT_TRUE(render());
+    {
+        auto path = SdfPath{"/Asset/BifrostGraph"};
+
+        // One child per output object, named after its index in the output.
+        auto childrenPaths = sceneIndex->GetChildPrimPaths(path);
+        ASSERT_EQ(childrenPaths.size(), 3);
+        std::sort(childrenPaths.begin(), childrenPaths.end());
+        for (size_t i = 0; i < childrenPaths.size(); ++i) {
+            EXPECT_EQ(childrenPaths[i],
+                      path.AppendChild(TfToken{"mesh" + std::to_string(i)}));
+            EXPECT_EQ(getHdPrim(childrenPaths[i]).primType,
+                      HdPrimTypeTokens->mesh);
+        }
+    }
+}
+
 TEST_F(TestSceneIndexPrim, create_strands_query) {
     std::string stageFilePath = BifrostUsd::TestUtils::getResourcePath(
                                     "create_strands_test1.usda")
@@ -109,8 +136,6 @@ TEST_F(TestSceneIndexPrim, create_strands_query) {
     }
 }
 
-#if 0
-// TODO(laforgg): Implement Instancing. Currenyly it is broken.
 TEST_F(TestSceneIndexPrim, create_instances_query) {
     std::string stageFilePath =
         BifrostUsd::TestUtils::getResourcePath("create_simple_instances_test.usda")
@@ -135,4 +160,3 @@ TEST_F(TestSceneIndexPrim, create_instances_query) {
                        "/tmp/hdCreateInstancesProc_protoChild.txt");
     }
 }
-#endif
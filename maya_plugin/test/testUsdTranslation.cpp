@@ -39,7 +39,7 @@ TEST(UsdTranslationTests, addStageToCache) {
     ASSERT_TRUE(
         PXR_NS::UsdUtilsStageCache::Get().Find(PXR_NS::UsdStageCache::Id::FromLongInt(
             static_cast<long int>(cacheId))) ==
-        const_cast<BifrostUsd::Stage&>(*stage).getStagePtr());
+        stage->getSharedStagePtr());
 
     delete translator;
 }
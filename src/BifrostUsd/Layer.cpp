@@ -22,6 +22,7 @@
 
 /// \todo BIFROST-6874 remove PXR_NS::Work_EnsureDetachedTaskProgress();
 #include <pxr/base/work/detachedTask.h>
+#include <pxr/base/work/dispatcher.h>
 
 // Note: To silence warnings coming from USD library
 #include <bifusd/config/CfgWarningMacros.h>
@@ -35,6 +36,8 @@ BIFUSD_WARNING_DISABLE_MSC(4800)
 #include <pxr/base/tf/pathUtils.h> // TfNormPath
 #include <pxr/usd/sdf/copyUtils.h>
 #include <pxr/usd/sdf/fileFormat.h>
+#include <pxr/usd/sdf/schema.h>
+#include <pxr/usd/sdf/textFileFormat.h>
 #include <pxr/usd/usd/attribute.h>
 #include <pxr/usd/usd/prim.h>
 #include <pxr/usd/usd/stage.h>
@@ -43,7 +46,12 @@ BIFUSD_WARNING_POP
 
 #include <Amino/Cpp/ClassDefine.h>
 
+#include <atomic>
+#include <mutex>
+#include <set>
+#include <sstream>
 #include <string>
+#include <vector>
 
 namespace {
 
@@ -121,6 +129,64 @@ Amino::Array<Sublayer> getSublayers(const PXR_NS::SdfLayerRefPtr& layer) {
     return layers;
 }
 
+/// Replaces the sublayer paths of the layer that differ from the given ones.
+/// The offsets of the replaced sublayers are reset.
+void replaceSubLayerPaths(PXR_NS::SdfLayer&               layer,
+                          const std::vector<std::string>& subLayerPaths) {
+    const std::vector<std::string> current = layer.GetSubLayerPaths();
+    for (int i = 0; i < static_cast<int>(subLayerPaths.size()); ++i) {
+        if (i < static_cast<int>(current.size()) &&
+            current[i] == subLayerPaths[i]) {
+            continue;
+        }
+        layer.RemoveSubLayerPath(i);
+        layer.InsertSubLayerPath(subLayerPaths[i], i);
+    }
+}
+
+/// Returns the text of a prim spec, without the blank lines USD may write
+/// around it.
+std::string primToString(const PXR_NS::SdfPrimSpecHandle& prim) {
+    static const auto textFileFormat = PXR_NS::SdfFileFormat::FindById(
+        PXR_NS::SdfTextFileFormatTokens->Id);
+    std::ostringstream stream;
+    textFileFormat->WriteToStream(prim, stream, 0);
+    std::string text  = stream.str();
+    const auto  first = text.find_first_not_of('\n');
+    const auto  last  = text.find_last_not_of('\n');
+    if (first == std::string::npos) return std::string();
+    return text.substr(first, last - first + 1);
+}
+
+/// Writes the layer metadata, then each root prim, to the sink. Only the
+/// metadata is copied, in a small anonymous layer, to get its text.
+bool writeChunks(const PXR_NS::SdfLayer&          layer,
+                 const std::vector<std::string>*  subLayerPaths,
+                 const BifrostUsd::Layer::ChunkSink& sink) {
+    auto header = PXR_NS::SdfLayer::CreateAnonymous(".usda");
+    const auto& root = PXR_NS::SdfPath::AbsoluteRootPath();
+    for (const auto& field : layer.ListFields(root)) {
+        if (field != PXR_NS::SdfChildrenKeys->PrimChildren) {
+            header->SetField(root, field, layer.GetField(root, field));
+        }
+    }
+    if (subLayerPaths) {
+        replaceSubLayerPaths(*header, *subLayerPaths);
+    }
+
+    std::string chunk;
+    header->ExportToString(&chunk);
+    if (!sink(chunk)) return false;
+
+    // Root prims are separated, and the text ends, with a blank line.
+    for (const auto& prim : layer.GetRootPrims()) {
+        chunk = primToString(prim);
+        chunk += "\n\n";
+        if (!sink(chunk)) return false;
+    }
+    return true;
+}
+
 } // namespace
 
 namespace BifrostUsd {
@@ -268,6 +334,81 @@ Layer::Layer(const Layer& other, const Amino::String& savefilePath)
 
 Layer::Layer(const Layer& other) : Layer(other, "") {}
 
+Layer::Layer(const Layer& other, ShareSubLayers)
+    : m_filePath(other.m_filePath),
+      m_fileFormat(other.m_fileFormat),
+      m_originalFilePath(other.m_originalFilePath),
+      m_tag(other.m_tag) {
+    if (!other.isValid()) {
+        return;
+    }
+
+    m_subLayers.reserve(other.m_subLayers.size());
+    for (const auto& sublayer : other.m_subLayers) {
+        m_subLayers.push_back(Layer(sublayer, ShareAll{}));
+    }
+
+    if (other.m_layer->PermissionToEdit()) {
+        m_layer = PXR_NS::SdfLayer::CreateAnonymous(m_tag.c_str());
+        m_layer->TransferContent(other.m_layer);
+
+        // The sublayers are shared, but sublayer paths that are relative to
+        // the other layer's file would not resolve from the anonymous copy.
+        // Refer to the shared sublayers by their identifiers instead.
+        const std::vector<std::string> subLayerPaths =
+            m_layer->GetSubLayerPaths();
+        for (int i = 0; i < static_cast<int>(m_subLayers.size()) &&
+                        i < static_cast<int>(subLayerPaths.size());
+             ++i) {
+            const std::string& identifier = m_subLayers[i]->GetIdentifier();
+            if (subLayerPaths[i] != identifier) {
+                m_layer->RemoveSubLayerPath(i);
+                m_layer->InsertSubLayerPath(identifier, i);
+            }
+        }
+    } else {
+        m_layer = other.m_layer;
+    }
+}
+
+Layer::Layer(const Layer& other, ShareAll)
+    : m_layer(other.m_layer),
+      m_filePath(other.m_filePath),
+      m_fileFormat(other.m_fileFormat),
+      m_originalFilePath(other.m_originalFilePath),
+      m_tag(other.m_tag) {
+    m_subLayers.reserve(other.m_subLayers.size());
+    for (const auto& sublayer : other.m_subLayers) {
+        m_subLayers.push_back(Layer(sublayer, ShareAll{}));
+    }
+}
+
+Layer::Layer(const PXR_NS::SdfLayerRefPtr& layer,
+             const Amino::String&          originalFilePath,
+             ShareAll)
+    : m_layer(layer) {
+    auto validOriginalPath = originalFilePath.empty() ? "" :
+        getPathWithValidUsdFileFormat(originalFilePath);
+
+    // Same paths and tag than an editable layer created from the SdfLayer:
+    m_filePath         = validOriginalPath;
+    m_originalFilePath = (originalFilePath.empty() && layer != nullptr)
+                            ? layer->GetIdentifier().c_str()
+                            : validOriginalPath;
+    m_tag = getTagWithValidUsdFileFormat(layer != nullptr
+                                            ? layer->GetDisplayName().c_str()
+                                            : "");
+    if (layer == nullptr) {
+        return;
+    }
+    auto sublayers = getSublayers(layer);
+    m_subLayers.reserve(sublayers.size());
+    for (const auto& sublayer : sublayers) {
+        m_subLayers.push_back(
+            Layer(sublayer.sublayer, sublayer.sublayerPath, ShareAll{}));
+    }
+}
+
 Layer& Layer::operator=(const Layer& other) {
     return *this = Layer(other);
 }
@@ -375,8 +516,44 @@ Layer const& Layer::getSubLayer(int index) const {
     return m_subLayers[index];
 }
 
+bool Layer::detachSubLayer(int index) {
+    if (!isValid() || !m_layer->PermissionToEdit() || index < 0 ||
+        index >= static_cast<int>(m_subLayers.size())) {
+        return false;
+    }
+    auto& sublayer = m_subLayers[index];
+    if (!sublayer.isValid() || !sublayer->PermissionToEdit()) {
+        return false;
+    }
+
+    sublayer = Layer(sublayer, ShareSubLayers{});
+
+    m_layer->RemoveSubLayerPath(index);
+    m_layer->InsertSubLayerPath(sublayer->GetIdentifier(), index);
+    return true;
+}
+
+struct Layer::ExportedFilePaths {
+    /// Returns true if the given file path was not exported yet.
+    bool insert(const std::string& filePath) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_filePaths.insert(filePath).second;
+    }
+
+private:
+    std::mutex            m_mutex;
+    std::set<std::string> m_filePaths;
+};
+
 bool Layer::exportToFile(const Amino::String& filePath,
                          bool                 relativePath) const {
+    ExportedFilePaths exportedPaths;
+    return exportToFile(filePath, relativePath, exportedPaths);
+}
+
+bool Layer::exportToFile(const Amino::String& filePath,
+                         bool                 relativePath,
+                         ExportedFilePaths&   exportedPaths) const {
     std::string outFilePath =
         filePath.empty() ? m_filePath.c_str() :
             getPathWithValidUsdFileFormat(filePath).c_str();
@@ -384,29 +561,16 @@ bool Layer::exportToFile(const Amino::String& filePath,
         return false;
     }
 
-    auto fileFormat = PXR_NS::SdfFileFormat::FindByExtension(
-        m_fileFormat.empty() ? outFilePath : m_fileFormat.c_str());
-
-    // Create a new SdfLayer that is not yet saved to the disk.
-    // Note: We do not use SdfLayer::CreateNew() because it immediately saves
-    //       the file to disk, and then it can randomly fail when running unit
-    //       tests in parallel on Windows (as if there could still be an open
-    //       handle to such file when the call to Save() is executed below,
-    //       producing an intermittent access denied error).
-    auto outLayer   = PXR_NS::SdfLayer::New(fileFormat, outFilePath);
-    if (!outLayer) {
-        return false;
-    }
-    // Update new SdfLayer's content from this Layer's content:
-    outLayer->TransferContent(m_layer);
-
     // Replace anonymous sublayer identifier by real layer file path
-    for (int i = 0; i < static_cast<int>(m_subLayers.size()); ++i) {
-        const auto& layer = m_subLayers[i];
+    const Amino::String parent =
+        relativePath ? Bifrost::FileUtils::extractParentPath(outFilePath.c_str())
+                     : Amino::String();
+    std::vector<std::string> subLayerPaths;
+    subLayerPaths.reserve(m_subLayers.size());
+    for (const auto& layer : m_subLayers) {
         Amino::String sdfLayerIdentifier = layer.m_filePath.empty() ?
             layer.m_originalFilePath : layer.m_filePath;
         if (relativePath) {
-            Amino::String parent = Bifrost::FileUtils::extractParentPath(outFilePath.c_str());
             Amino::String relPath = Bifrost::FileUtils::getRelativePath(sdfLayerIdentifier, parent).c_str();
             if (!relPath.empty()) {
                 sdfLayerIdentifier = PXR_NS::TfNormPath(relPath.c_str()).c_str();
@@ -415,34 +579,114 @@ bool Layer::exportToFile(const Amino::String& filePath,
         if (sdfLayerIdentifier.empty()) {
             return false;
         }
+        subLayerPaths.emplace_back(sdfLayerIdentifier.c_str());
+    }
 
-        layer.exportToFile(layer.m_filePath, relativePath);
+    // The sublayers are exported concurrently, while this layer is saved.
+    // Sublayers without a file path, or that can't be edited, are not
+    // exported: their identifier refers to a file that already exists.
+    // A sublayer that is used more than once, anywhere in the hierarchy, is
+    // exported only once.
+    std::atomic<bool>      subLayersSaved{true};
+    PXR_NS::WorkDispatcher dispatcher;
+    for (const auto& layer : m_subLayers) {
+        if (layer.m_filePath.empty() || !layer.isValid() ||
+            !layer->PermissionToEdit() ||
+            !exportedPaths.insert(layer.m_filePath.c_str())) {
+            continue;
+        }
+        dispatcher.Run(
+            [&layer, relativePath, &exportedPaths, &subLayersSaved]() {
+                if (!layer.exportToFile(layer.m_filePath, relativePath,
+                                        exportedPaths)) {
+                    subLayersSaved = false;
+                }
+            });
+    }
+
+    auto fileFormat = PXR_NS::SdfFileFormat::FindByExtension(
+        m_fileFormat.empty() ? outFilePath : m_fileFormat.c_str());
 
-        outLayer->RemoveSubLayerPath(i);
-        outLayer->InsertSubLayerPath(sdfLayerIdentifier.c_str(), i);
+    bool saved = false;
+    if (fileFormat == m_layer->GetFileFormat() &&
+        fileFormat == PXR_NS::SdfFileFormat::FindByExtension(outFilePath) &&
+        std::vector<std::string>(m_layer->GetSubLayerPaths()) ==
+            subLayerPaths) {
+        // No sublayer identifier to replace: the content of the layer is
+        // written as is, without copying it first.
+        saved = m_layer->Export(outFilePath);
+    } else {
+        // Create a new SdfLayer that is not yet saved to the disk.
+        // Note: We do not use SdfLayer::CreateNew() because it immediately saves
+        //       the file to disk, and then it can randomly fail when running unit
+        //       tests in parallel on Windows (as if there could still be an open
+        //       handle to such file when the call to Save() is executed below,
+        //       producing an intermittent access denied error).
+        auto outLayer   = PXR_NS::SdfLayer::New(fileFormat, outFilePath);
+        if (outLayer) {
+            // Update new SdfLayer's content from this Layer's content:
+            outLayer->TransferContent(m_layer);
+            outLayer->SetSubLayerPaths(subLayerPaths);
+            saved = outLayer->Save();
+        }
     }
 
-    return outLayer->Save();
+    dispatcher.Wait();
+    return saved && subLayersSaved;
 }
 
 Amino::String Layer::exportToString(bool exportSubLayers) const {
-    auto outLayer = PXR_NS::SdfLayer::CreateAnonymous(
-        getTagWithValidUsdFileFormat().c_str());
-    outLayer->TransferContent(m_layer);
+    std::string result;
+    auto        subLayerPaths = getExportedSubLayerPaths(exportSubLayers);
+    if (std::vector<std::string>(m_layer->GetSubLayerPaths()) ==
+        subLayerPaths) {
+        // No sublayer identifier to replace: the layer is exported without
+        // copying it first.
+        m_layer->ExportToString(&result);
+    } else {
+        auto outLayer = PXR_NS::SdfLayer::CreateAnonymous(
+            getTagWithValidUsdFileFormat().c_str());
+        outLayer->TransferContent(m_layer);
+        replaceSubLayerPaths(*outLayer, subLayerPaths);
+        outLayer->ExportToString(&result);
+    }
+    return result.c_str();
+}
+
+bool Layer::exportToChunks(const ChunkSink& sink, bool exportSubLayers) const {
+    auto subLayerPaths = getExportedSubLayerPaths(exportSubLayers);
+    return writeChunks(*m_layer, &subLayerPaths, sink);
+}
+
+bool Layer::exportToChunks(const PXR_NS::SdfLayer& layer,
+                           const ChunkSink&        sink) {
+    return writeChunks(layer, nullptr, sink);
+}
+
+size_t Layer::exportedSize(bool exportSubLayers) const {
+    size_t size = 0;
+    exportToChunks(
+        [&size](const std::string& chunk) {
+            size += chunk.size();
+            return true;
+        },
+        exportSubLayers);
+    return size;
+}
 
+std::vector<std::string> Layer::getExportedSubLayerPaths(
+    bool exportSubLayers) const {
+    std::vector<std::string> subLayerPaths = m_layer->GetSubLayerPaths();
     if (exportSubLayers) {
-        for (int i = 0; i < static_cast<int>(m_subLayers.size()); ++i) {
+        for (size_t i = 0;
+             i < m_subLayers.size() && i < subLayerPaths.size(); ++i) {
             const auto& layer = m_subLayers[i];
             auto filepath = layer.m_filePath.empty() ? layer.m_originalFilePath
                                                      : layer.m_filePath;
-            outLayer->RemoveSubLayerPath(i);
-            outLayer->InsertSubLayerPath(filepath.c_str(), i);
+            subLayerPaths[i] = filepath.c_str();
         }
     }
-
-    std::string result;
-    outLayer->ExportToString(&result);
-    return result.c_str();
+    return subLayerPaths;
 }
 
 Amino::String Layer::getTagWithValidUsdFileFormat(const Amino::String& tag) {
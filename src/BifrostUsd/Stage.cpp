@@ -55,7 +55,9 @@ namespace BifrostUsd {
 
 Stage::Stage()
     : m_rootLayer(Amino::newClassPtr<Layer>()),
-      m_stage(PXR_NS::UsdStage::Open(m_rootLayer->m_layer)) {}
+      m_stage(PXR_NS::UsdStage::Open(m_rootLayer->m_layer)) {
+    resetSubLayerTokens();
+}
 
 Stage::Stage(Invalid) { assert(!isValid()); }
 
@@ -64,7 +66,9 @@ Stage::Stage(const Layer& rootLayer, const InitialLoadSet load)
       m_stage(
           PXR_NS::UsdStage::Open(m_rootLayer->m_layer, GetPxrInitialLoadSet(load)))
 
-{}
+{
+    resetSubLayerTokens();
+}
 
 Stage::Stage(const Layer&                       rootLayer,
              const PXR_NS::UsdStagePopulationMask& mask,
@@ -73,26 +77,59 @@ Stage::Stage(const Layer&                       rootLayer,
       m_stage(PXR_NS::UsdStage::OpenMasked(
           m_rootLayer->m_layer, mask, GetPxrInitialLoadSet(load)))
 
-{}
+{
+    resetSubLayerTokens();
+}
 
 Stage::Stage(const Amino::String& filePath, const InitialLoadSet load)
     : m_rootLayer(Amino::newClassPtr<Layer>(filePath, "")),
       m_stage(PXR_NS::UsdStage::Open(m_rootLayer->m_layer,
-                                  GetPxrInitialLoadSet(load))) {}
+                                  GetPxrInitialLoadSet(load))) {
+    resetSubLayerTokens();
+}
 
 Stage::Stage(const Amino::String&               filePath,
              const PXR_NS::UsdStagePopulationMask& mask,
              const InitialLoadSet               load)
     : m_rootLayer(Amino::newClassPtr<Layer>(filePath, "")),
       m_stage(PXR_NS::UsdStage::OpenMasked(
-          m_rootLayer->m_layer, mask, GetPxrInitialLoadSet(load))) {}
+          m_rootLayer->m_layer, mask, GetPxrInitialLoadSet(load))) {
+    resetSubLayerTokens();
+}
 
-Stage::Stage(const Stage& other) : Stage(*other.m_rootLayer) {
-    // The newly created UsdStage has the root layer as its default EditTarget.
-    // We can't just copy the m_editLayerIndex, but must set the desired
-    // layer as the EditTarget:
-    setEditLayerIndex(other.m_editLayerIndex, true);
+Stage::Stage(const PXR_NS::UsdStageRefPtr& stage)
+    : m_rootLayer(stage ? Amino::newClassPtr<Layer>(Layer(
+                              stage->GetRootLayer(), "", Layer::ShareAll{}))
+                        : Amino::Ptr<Layer>()),
+      m_stage(stage),
+      m_isExternalStage(true) {
+    // No sublayer tokens: all the sublayers are owned by the given UsdStage.
+    // Its EditTarget is left untouched, it is only set on the detached stage.
+    // Report it if it is one of the sublayers of the root layer, otherwise
+    // the detached stage targets the root layer.
+    if (stage) {
+        const auto editLayer     = stage->GetEditTarget().GetLayer();
+        const auto rootLayer     = stage->GetRootLayer();
+        const auto subLayerPaths = rootLayer->GetSubLayerPaths();
+        for (size_t i = 0; i < subLayerPaths.size(); ++i) {
+            if (editLayer && editLayer == PXR_NS::SdfLayer::FindRelativeToLayer(
+                                              rootLayer, subLayerPaths[i])) {
+                m_editLayerIndex = static_cast<int>(i);
+                break;
+            }
+        }
+    }
+}
 
+Stage::Stage(const Stage& other)
+    : m_rootLayer(other.m_rootLayer),
+      m_stage(other.m_stage),
+      m_editLayerIndex(other.m_editLayerIndex),
+      m_subLayerTokens(other.m_subLayerTokens),
+      m_isExternalStage(other.m_isExternalStage) {
+    // The UsdStage and the layers are shared with the other stage until one
+    // of them is modified (see detach()). The EditTarget of the shared
+    // UsdStage is already the desired layer.
     last_modified_prim             = other.last_modified_prim;
     last_modified_variant_set_prim = other.last_modified_variant_set_prim;
     last_modified_variant_set_name = other.last_modified_variant_set_name;
@@ -100,19 +137,18 @@ Stage::Stage(const Stage& other) : Stage(*other.m_rootLayer) {
 }
 
 Stage& Stage::operator=(const Stage& other) {
-    m_rootLayer = Amino::newClassPtr<Layer>(*other.m_rootLayer);
-    m_stage     = PXR_NS::UsdStage::Open(m_rootLayer->m_layer);
-
-    // The newly created UsdStage has the root layer as its default EditTarget.
-    // We can't just copy the m_editLayerIndex, but must set the desired
-    // layer as the EditTarget:
-    setEditLayerIndex(other.m_editLayerIndex, true);
-
-    last_modified_prim             = other.last_modified_prim;
-    last_modified_variant_set_prim = other.last_modified_variant_set_prim;
-    last_modified_variant_set_name = other.last_modified_variant_set_name;
-    last_modified_variant_name     = other.last_modified_variant_name;
+    if (this != &other) {
+        m_rootLayer      = other.m_rootLayer;
+        m_stage          = other.m_stage;
+        m_editLayerIndex = other.m_editLayerIndex;
+        m_subLayerTokens = other.m_subLayerTokens;
+        m_isExternalStage = other.m_isExternalStage;
 
+        last_modified_prim             = other.last_modified_prim;
+        last_modified_variant_set_prim = other.last_modified_variant_set_prim;
+        last_modified_variant_set_name = other.last_modified_variant_set_name;
+        last_modified_variant_name     = other.last_modified_variant_name;
+    }
     return *this;
 }
 
@@ -127,6 +163,8 @@ Stage& Stage::operator=(Stage&& other) noexcept {
         // We don't need to set the EditTarget again in UsdStage since it is
         // already done. We just need to copy the m_editLayerIndex:
         m_editLayerIndex = other.m_editLayerIndex;
+        m_subLayerTokens = std::move(other.m_subLayerTokens);
+        m_isExternalStage = other.m_isExternalStage;
 
         last_modified_prim = std::move(other.last_modified_prim);
         last_modified_variant_set_prim =
@@ -143,6 +181,30 @@ bool Stage::setEditLayerIndex(const int layerIndex,
                               bool      defaultToRoot) {
     if (!isValid())
         return false;
+
+    // The EditTarget is a state of the UsdStage. Find the layer that will be
+    // targeted, and make sure it is not shared before changing it.
+    int targetIndex = -1;
+    if (layerIndex >= 0 &&
+        static_cast<size_t>(layerIndex) <
+            m_stage->GetRootLayer()->GetNumSubLayerPaths()) {
+        targetIndex = layerIndex;
+    } else if (layerIndex != -1 && !defaultToRoot) {
+        return false;
+    }
+    if (targetIndex == m_editLayerIndex) {
+        // Nothing to change; don't detach a shared stage for nothing.
+        return true;
+    }
+    detach(targetIndex);
+
+    return applyEditLayerIndex(layerIndex, defaultToRoot);
+}
+
+bool Stage::applyEditLayerIndex(const int layerIndex,
+                                bool      defaultToRoot) {
+    if (!isValid())
+        return false;
     if (layerIndex >= 0) {
         auto subLayerPaths = m_stage->GetRootLayer()->GetSubLayerPaths();
         const size_t numLayers = subLayerPaths.size();
@@ -166,6 +228,81 @@ bool Stage::setEditLayerIndex(const int layerIndex,
     return false;
 }
 
+void Stage::detach(int editLayerIndex) {
+    if (!isValid()) {
+        return;
+    }
+    const bool sharedRoot =
+        m_isExternalStage || m_rootLayer.use_count() > 1;
+    const bool sharedSubLayer = isSubLayerShared(editLayerIndex);
+    if (!sharedRoot && !sharedSubLayer) {
+        return;
+    }
+
+    if (m_subLayerTokens.size() < m_rootLayer->getSubLayers().size()) {
+        // Sublayers without a token are conservatively considered shared
+        // (see isSubLayerShared()).
+        m_subLayerTokens.resize(m_rootLayer->getSubLayers().size());
+    }
+
+    if (sharedRoot) {
+        // Copy the root layer only. The sublayers are still shared, except
+        // the one that is about to be edited.
+        auto rootLayer = Amino::newMutablePtr<Layer>(
+            Layer(*m_rootLayer, Layer::ShareSubLayers{}));
+        if (sharedSubLayer && rootLayer->detachSubLayer(editLayerIndex)) {
+            m_subLayerTokens[editLayerIndex] =
+                std::make_shared<SubLayerToken>();
+        }
+
+        // Compose a new UsdStage with the same session layer, population
+        // mask and load rules than the shared one. The session layer is
+        // never edited, so it can stay shared.
+        auto stage = PXR_NS::UsdStage::OpenMasked(
+            rootLayer->m_layer, m_stage->GetSessionLayer(),
+            m_stage->GetPopulationMask(),
+            PXR_NS::UsdStage::InitialLoadSet::LoadNone);
+        stage->SetLoadRules(m_stage->GetLoadRules());
+
+        m_rootLayer       = std::move(rootLayer);
+        m_stage           = std::move(stage);
+        m_isExternalStage = false;
+    } else {
+        // Only the sublayer is shared. We can't let the UsdStage continue to
+        // refer to it as its EditTarget while it is replaced.
+        m_stage->SetEditTarget(m_stage->GetRootLayer());
+        auto rootLayer = Amino::createPtrGuard(m_rootLayer,
+                                               Amino::PtrGuardUniqueFlag{});
+        if (rootLayer->detachSubLayer(editLayerIndex)) {
+            m_subLayerTokens[editLayerIndex] =
+                std::make_shared<SubLayerToken>();
+        }
+    }
+
+    // Restore the EditTarget on the detached UsdStage:
+    applyEditLayerIndex(m_editLayerIndex, true);
+}
+
+bool Stage::isSubLayerShared(int layerIndex) const {
+    if (layerIndex < 0) {
+        return false;
+    }
+    return static_cast<size_t>(layerIndex) >= m_subLayerTokens.size() ||
+           !m_subLayerTokens[layerIndex] ||
+           m_subLayerTokens[layerIndex].use_count() > 1;
+}
+
+void Stage::resetSubLayerTokens() {
+    m_subLayerTokens.clear();
+    if (m_rootLayer) {
+        const size_t numLayers = m_rootLayer->getSubLayers().size();
+        m_subLayerTokens.reserve(numLayers);
+        for (size_t i = 0; i < numLayers; ++i) {
+            m_subLayerTokens.push_back(std::make_shared<SubLayerToken>());
+        }
+    }
+}
+
 PXR_NS::UsdVariantSet Stage::getLastModifedVariantSet() const {
     PXR_NS::UsdPrim variant_prim;
     if (this->hasLastModifiedVariantSetPrim()) {
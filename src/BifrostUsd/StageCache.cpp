@@ -34,8 +34,7 @@ bool StageCache::addStageToCache(const Amino::Ptr<BifrostUsd::Stage>& stage,
                                  int64_t& outId) {
     outId = -1;
     if (stage) {
-        auto usdStagePtr =
-            const_cast<Stage&>(*stage).getStagePtr();
+        auto usdStagePtr = stage->getSharedStagePtr();
         auto id = PXR_NS::UsdUtilsStageCache::Get().Insert(usdStagePtr);
 
         if (id && id.IsValid()) {
@@ -44,6 +44,10 @@ BIFUSD_WARNING_DISABLE_MSC(4800)
 
 BIFUSD_WARNING_POP
 
+#include <functional>
+#include <string>
+#include <vector>
+
 #endif // DISABLE_PXR_HEADERS
 
 namespace BifrostUsd {
@@ -168,6 +172,31 @@ public:
                       bool                 relativePath = false) const;
     Amino::String exportToString(bool exportSubLayers = true) const;
 
+    /// Function receiving the chunks of an exported layer, in order.
+    /// Returning false stops the export.
+    using ChunkSink = std::function<bool(const std::string& chunk)>;
+
+    /// This function exports this layer as USD text by chunks, without
+    /// copying the layer nor holding the whole text in memory. The first
+    /// chunk holds the layer metadata, and each following chunk holds a
+    /// root prim. The concatenated chunks are the text returned by
+    /// exportToString().
+    ///
+    /// \param [in] sink The function receiving the chunks.
+    /// \param [in] exportSubLayers Replace the anonymous sublayer identifiers
+    ///     by the sublayer file paths, like exportToString() does.
+    /// \returns true if all the chunks were passed to the sink.
+    bool exportToChunks(const ChunkSink& sink,
+                        bool             exportSubLayers = true) const;
+
+    /// Same as above, for a Pixar layer (e.g. a flattened stage).
+    static bool exportToChunks(const PXR_NS::SdfLayer& layer,
+                               const ChunkSink&        sink);
+
+    /// This function returns the size of the text exportToString() returns,
+    /// without holding the whole text in memory.
+    size_t exportedSize(bool exportSubLayers = true) const;
+
     /// This helper method converts its input string into a valid tag.
     /// A valid tag is a filename with a non-empty stem and a valid USD file
     /// extension (.usd, .usda or .usdc).
@@ -221,6 +250,52 @@ public:
 private:
     friend Stage;
 
+    /// Tag used to create a copy of a layer that shares the underlying
+    /// SdfLayers of its sublayers with the copied layer, instead of
+    /// copying them. Only the content of the copied layer itself is
+    /// duplicated.
+    struct ShareSubLayers {};
+
+    /// Tag used to create a layer that shares its underlying SdfLayer, and
+    /// the ones of all its sublayers, with another layer.
+    struct ShareAll {};
+
+    /// Returns the sublayer paths written when exporting this layer.
+    std::vector<std::string> getExportedSubLayerPaths(bool exportSubLayers) const;
+
+    /// The file paths of the sublayers exported by an exportToFile() call,
+    /// shared by the whole sublayer hierarchy, so that a sublayer used more
+    /// than once in the hierarchy is written only once.
+    struct ExportedFilePaths;
+
+    bool exportToFile(const Amino::String& filePath,
+                      bool                 relativePath,
+                      ExportedFilePaths&   exportedPaths) const;
+
+    Layer(const Layer& other, ShareSubLayers);
+    Layer(const Layer& other, ShareAll);
+
+    /// Creates a layer that wraps the given SdfLayer, and its sublayers,
+    /// without copying them and without changing their edit permissions.
+    /// Used to wrap the layers of a PXR_NS::UsdStage owned by someone else.
+    ///
+    /// \param [in] layer The SdfLayer to wrap.
+    /// \param [in] originalFilePath The path used to refer to this layer from
+    ///     its parent layer, or empty for a root layer.
+    Layer(const PXR_NS::SdfLayerRefPtr& layer,
+          const Amino::String&          originalFilePath,
+          ShareAll);
+
+    /// This function replaces the sublayer at the given index by a copy of
+    /// its content that is not shared with any other layer. The sublayers of
+    /// the copied sublayer are still shared.
+    ///
+    /// \param [in] index The index of the sublayer to copy, where 0
+    ///     corresponds to the strongest sublayer in the Pixar SdfLayer.
+    /// \returns true if the sublayer was copied; false if the index is
+    ///     invalid, or if this layer or the sublayer is not editable.
+    bool detachSubLayer(int index);
+
     /// The underlying anonymous sdf layer.
     PXR_NS::SdfLayerRefPtr m_layer;
 
@@ -47,6 +47,9 @@ BIFUSD_WARNING_POP
 
 #include "Layer.h"
 
+#include <memory>
+#include <vector>
+
 #endif // DISABLE_PXR_HEADERS
 
 namespace BifrostUsd {
@@ -129,6 +132,12 @@ enum /*@cond true*/ AMINO_ANNOTATE(
 
 /// \class Stage Stage.h
 /// \brief Bifrost USD Stage type that flows in the graph.
+///
+/// Copies of a Stage are copy-on-write: they share the same
+/// PXR_NS::UsdStage and layers until one of them is modified. The first
+/// modification detaches the modified copy, duplicating only its root layer
+/// and the sublayer set as its EditTarget, if any. The other sublayers stay
+/// shared until they become the EditTarget of a modified copy.
 class AMINO_ANNOTATE("Amino::Class") USD_DECL Stage {
 public:
     Stage();
@@ -147,6 +156,15 @@ public:
                    const PXR_NS::UsdStagePopulationMask& mask,
                    const InitialLoadSet load = InitialLoadSet::LoadAll);
 
+    /// \brief Wraps an existing PXR_NS::UsdStage without reloading it.
+    ///
+    /// The given UsdStage and its layers are not copied: they are shared with
+    /// their owner (for example the PXR_NS::UsdUtilsStageCache) the same way
+    /// copies of a Stage share them, and the first modification of this
+    /// stage detaches it (see \ref detach). Until then, changes made to the
+    /// given UsdStage by its owner are visible from this stage.
+    explicit Stage(const PXR_NS::UsdStageRefPtr& stage);
+
     Stage(const Stage& other);
     Stage& operator=(const Stage& other);
 
@@ -164,22 +182,45 @@ public:
     ///
     /// This helps avoiding unintentionally creating side effects in other
     /// pointers to the same \ref BifrostUsd::Stage.
+    ///
+    /// The non-const accessors detach this stage from its copies (see
+    /// \ref detach) before returning it.
     /// \{
     /// \return UsdStage
-    PXR_NS::UsdStage&       get() { return *m_stage; }
+    PXR_NS::UsdStage&       get() { detach(); return *m_stage; }
     PXR_NS::UsdStage const& get() const { return *m_stage; }
-    PXR_NS::UsdStage&       operator*() { return *m_stage; }
+    PXR_NS::UsdStage&       operator*() { detach(); return *m_stage; }
     PXR_NS::UsdStage const& operator*() const { return *m_stage; }
-    PXR_NS::UsdStage*       operator->() { return m_stage.operator->(); }
+    PXR_NS::UsdStage*       operator->() { detach(); return m_stage.operator->(); }
     PXR_NS::UsdStage const* operator->() const { return m_stage.operator->(); }
     /// \}
 
     // This function is purposefully non-const. Be careful with it.
-    PXR_NS::UsdStageRefPtr getStagePtr() { return m_stage; }
+    PXR_NS::UsdStageRefPtr getStagePtr() { detach(); return m_stage; }
+
+    /// \brief Returns the underlying PXR_NS::UsdStage without detaching this
+    /// stage from its copies.
+    ///
+    /// The returned PXR_NS::UsdStage may be shared with other copies of this
+    /// stage, so it must not be modified.
+    PXR_NS::UsdStageRefPtr getSharedStagePtr() const { return m_stage; }
 
-    Amino::Ptr<Layer>&       getRootLayer() { return m_rootLayer; }
+    Amino::Ptr<Layer>&       getRootLayer() { detach(); return m_rootLayer; }
     const Amino::Ptr<Layer>& getRootLayer() const { return m_rootLayer; }
 
+    /// \brief Makes sure this stage does not share with its copies the data
+    /// that is about to be modified.
+    ///
+    /// If the root layer is shared, a new root layer and a new
+    /// PXR_NS::UsdStage are created for this stage. If the sublayer set as
+    /// EditTarget is shared, it is replaced by a copy of its content.
+    /// Nothing is done if nothing is shared.
+    ///
+    /// All non-const accessors call this function. It only needs to be called
+    /// explicitly before modifying the stage through objects that were
+    /// obtained from the const accessors, like a PXR_NS::UsdPrim.
+    void detach() { detach(m_editLayerIndex); }
+
     /// Get the index of the current stage's EditTarget layer.
     ///
     /// \return The index of the layer that is set as the current EditTarget.
@@ -221,9 +262,31 @@ public:
     Amino::String last_modified_variant_name;
 
 private:
+    /// Ownership token of a sublayer of the root layer. The sublayer is
+    /// shared with other stages as long as its token is.
+    struct SubLayerToken {};
+
+    /// Detaches the root layer (if shared) and the sublayer at the given
+    /// index (if shared) from the other copies of this stage.
+    void detach(int editLayerIndex);
+
+    /// Sets the UsdStage's EditTarget without detaching this stage.
+    bool applyEditLayerIndex(int layerIndex, bool defaultToRoot);
+
+    bool isSubLayerShared(int layerIndex) const;
+    void resetSubLayerTokens();
+
     Amino::Ptr<Layer>   m_rootLayer;
     PXR_NS::UsdStageRefPtr m_stage;
     int                 m_editLayerIndex{-1};
+
+    /// The ownership tokens of the sublayers of the root layer, in the same
+    /// order than m_rootLayer's sublayers.
+    std::vector<std::shared_ptr<SubLayerToken>> m_subLayerTokens;
+
+    /// True if m_stage and the root layer are owned by someone else than the
+    /// Stage copies, in which case they are always considered shared.
+    bool m_isExternalStage{false};
 #endif // DISABLE_PXR_HEADERS
 };
 } // namespace BifrostUsd
@@ -17,11 +17,18 @@
 #include "usd_attribute_nodedefs.h"
 
 #include <Amino/Core/String.h>
+#include <pxr/base/work/loops.h>
+#include <pxr/usd/sdf/attributeSpec.h>
+#include <pxr/usd/sdf/changeBlock.h>
 #include <pxr/usd/sdf/copyUtils.h>
+#include <pxr/usd/sdf/primSpec.h>
+#include <pxr/usd/usd/attributeQuery.h>
 #include <pxr/usd/usd/editContext.h>
 #include <pxr/usd/usdGeom/primvarsAPI.h>
 
+#include <algorithm>
 #include <cstdint>
+#include <vector>
 
 #include "return_guard.h"
 #include "usd_type_converter.h"
@@ -217,47 +224,72 @@ bool USD::Attribute::get_prim_attribute(
 }
 
 namespace {
+/// Reads the values of an attribute, either directly from the UsdAttribute,
+/// or through a UsdAttributeQuery that caches the value resolution of the
+/// attribute when reading it at several times.
+class AttributeReader {
+public:
+    explicit AttributeReader(const PXR_NS::UsdAttribute& attribute)
+        : m_attribute(attribute) {}
+    explicit AttributeReader(const PXR_NS::UsdAttributeQuery& query)
+        : m_attribute(query.GetAttribute()), m_query(&query) {}
+
+    PXR_NS::SdfValueTypeName GetTypeName() const {
+        return m_attribute.GetTypeName();
+    }
+
+    template <typename T>
+    bool Get(T* value, PXR_NS::UsdTimeCode time) const {
+        return m_query ? m_query->Get(value, time)
+                       : m_attribute.Get(value, time);
+    }
+
+private:
+    const PXR_NS::UsdAttribute&      m_attribute;
+    const PXR_NS::UsdAttributeQuery* m_query = nullptr;
+};
+
 template <typename DESTTYPE>
-bool get_attribute_data(const BifrostUsd::Attribute& attribute,
-                        const float                    frame,
-                        DESTTYPE&                      value) {
+bool get_attribute_data(const AttributeReader& attribute,
+                        const float            frame,
+                        DESTTYPE&              value) {
     PxrType_t<DESTTYPE> result;
-    bool success = attribute->Get(&result, static_cast<double>(frame));
+    bool success = attribute.Get(&result, static_cast<double>(frame));
     value        = fromPxr(result);
     return success;
 }
 template <>
-bool get_attribute_data(const BifrostUsd::Attribute& attribute,
-                        const float                    frame,
-                        Amino::String&                 value) {
+bool get_attribute_data(const AttributeReader& attribute,
+                        const float            frame,
+                        Amino::String&         value) {
     value          = Amino::String(); // set default
-    auto type_name = attribute->GetTypeName();
+    auto type_name = attribute.GetTypeName();
     if (type_name == PXR_NS::SdfValueTypeNames->Asset) {
         PXR_NS::SdfAssetPath result;
-        bool success = attribute->Get(&result, static_cast<double>(frame));
+        bool success = attribute.Get(&result, static_cast<double>(frame));
         if (success) value = result.GetAssetPath().c_str();
         return success;
     } else if (type_name == PXR_NS::SdfValueTypeNames->Token) {
         PXR_NS::TfToken result;
-        bool success = attribute->Get(&result, static_cast<double>(frame));
+        bool success = attribute.Get(&result, static_cast<double>(frame));
         if (success) value = result.GetText();
         return success;
     }
     PxrType_t<Amino::String> result;
-    bool success = attribute->Get(&result, static_cast<double>(frame));
+    bool success = attribute.Get(&result, static_cast<double>(frame));
     if (success) value = fromPxr(result);
     return success;
 }
 template <>
-bool get_attribute_data(const BifrostUsd::Attribute& attribute,
-                        const float                    frame,
-                        Amino::Array<Amino::String>&   value) {
+bool get_attribute_data(const AttributeReader&       attribute,
+                        const float                  frame,
+                        Amino::Array<Amino::String>& value) {
     value          = Amino::Array<Amino::String>(); // set default
-    auto type_name = attribute->GetTypeName();
+    auto type_name = attribute.GetTypeName();
     // get as asset array, token array or regular string array
     if (type_name == PXR_NS::SdfValueTypeNames->AssetArray) {
         PXR_NS::VtArray<PXR_NS::SdfAssetPath> result;
-        bool success = attribute->Get(&result, static_cast<double>(frame));
+        bool success = attribute.Get(&result, static_cast<double>(frame));
         if (success) {
             auto out = Amino::Array<Amino::String>(result.size());
             for (unsigned i = 0; i < result.size(); ++i) {
@@ -268,7 +300,7 @@ bool get_attribute_data(const BifrostUsd::Attribute& attribute,
         return success;
     } else if (type_name == PXR_NS::SdfValueTypeNames->TokenArray) {
         PXR_NS::VtTokenArray result;
-        bool success = attribute->Get(&result, static_cast<double>(frame));
+        bool success = attribute.Get(&result, static_cast<double>(frame));
         if (success) {
             auto out = Amino::Array<Amino::String>(result.size());
             for (unsigned i = 0; i < result.size(); ++i) {
@@ -280,37 +312,37 @@ bool get_attribute_data(const BifrostUsd::Attribute& attribute,
     }
 
     PxrType_t<Amino::Array<Amino::String>> result;
-    bool success = attribute->Get(&result, static_cast<double>(frame));
+    bool success = attribute.Get(&result, static_cast<double>(frame));
     if (success) value = fromPxr(result);
     return success;
 }
 template <>
-bool get_attribute_data(const BifrostUsd::Attribute& attribute,
-                        const float                  frame,
-                        float&                       value) {
+bool get_attribute_data(const AttributeReader& attribute,
+                        const float            frame,
+                        float&                 value) {
     value          = float(); // set default
-    auto type_name = attribute->GetTypeName();
+    auto type_name = attribute.GetTypeName();
     if (type_name == PXR_NS::SdfValueTypeNames->Half) {
         PXR_NS::GfHalf result;
-        bool success = attribute->Get(&result, static_cast<double>(frame));
+        bool success = attribute.Get(&result, static_cast<double>(frame));
         if (success) value = result;
         return success;
     }
 
     PxrType_t<float> result;
-    bool success = attribute->Get(&result, static_cast<double>(frame));
+    bool success = attribute.Get(&result, static_cast<double>(frame));
     if (success) value = fromPxr(result);
     return success;
 }
 template <>
-bool get_attribute_data(const BifrostUsd::Attribute& attribute,
-                        const float                  frame,
-                        Amino::Array<float>&         value) {
+bool get_attribute_data(const AttributeReader& attribute,
+                        const float            frame,
+                        Amino::Array<float>&   value) {
     value          = Amino::Array<float>(); // set default
-    auto type_name = attribute->GetTypeName();
+    auto type_name = attribute.GetTypeName();
     if (type_name == PXR_NS::SdfValueTypeNames->HalfArray) {
         PXR_NS::VtHalfArray result;
-        bool success = attribute->Get(&result, static_cast<double>(frame));
+        bool success = attribute.Get(&result, static_cast<double>(frame));
         if (success) {
             auto out = Amino::Array<float>(result.size());
             for (unsigned i = 0; i < result.size(); ++i)
@@ -321,19 +353,19 @@ bool get_attribute_data(const BifrostUsd::Attribute& attribute,
     }
 
     PxrType_t<Amino::Array<float>> result;
-    bool success = attribute->Get(&result, static_cast<double>(frame));
+    bool success = attribute.Get(&result, static_cast<double>(frame));
     if (success) value = fromPxr(result);
     return success;
 }
 template <>
-bool get_attribute_data(const BifrostUsd::Attribute& attribute,
-                        const float                  frame,
-                        Bifrost::Math::float2&       value) {
+bool get_attribute_data(const AttributeReader& attribute,
+                        const float            frame,
+                        Bifrost::Math::float2& value) {
     value          = Bifrost::Math::float2(); // set default
-    auto type_name = attribute->GetTypeName();
+    auto type_name = attribute.GetTypeName();
     if (type_name == PXR_NS::SdfValueTypeNames->Half2) {
         PXR_NS::GfVec2h result;
-        bool success = attribute->Get(&result, static_cast<double>(frame));
+        bool success = attribute.Get(&result, static_cast<double>(frame));
         if (success) {
             value.x = result[0];
             value.y = result[1];
@@ -342,19 +374,19 @@ bool get_attribute_data(const BifrostUsd::Attribute& attribute,
     }
 
     PxrType_t<Bifrost::Math::float2> result;
-    bool success = attribute->Get(&result, static_cast<double>(frame));
+    bool success = attribute.Get(&result, static_cast<double>(frame));
     if (success) value = fromPxr(result);
     return success;
 }
 template <>
-bool get_attribute_data(const BifrostUsd::Attribute&         attribute,
+bool get_attribute_data(const AttributeReader&               attribute,
                         const float                          frame,
                         Amino::Array<Bifrost::Math::float2>& value) {
     value          = Amino::Array<Bifrost::Math::float2>(); // set default
-    auto type_name = attribute->GetTypeName();
+    auto type_name = attribute.GetTypeName();
     if (type_name == PXR_NS::SdfValueTypeNames->Half2Array) {
         PXR_NS::VtVec2hArray result;
-        bool success = attribute->Get(&result, static_cast<double>(frame));
+        bool success = attribute.Get(&result, static_cast<double>(frame));
         if (success) {
             auto out = Amino::Array<Bifrost::Math::float2>(result.size());
             for (unsigned i = 0; i < result.size(); ++i) {
@@ -368,19 +400,19 @@ bool get_attribute_data(const BifrostUsd::Attribute&         attribute,
     }
 
     PxrType_t<Amino::Array<Bifrost::Math::float2>> result;
-    bool success = attribute->Get(&result, static_cast<double>(frame));
+    bool success = attribute.Get(&result, static_cast<double>(frame));
     if (success) value = fromPxr(result);
     return success;
 }
 template <>
-bool get_attribute_data(const BifrostUsd::Attribute& attribute,
-                        const float                  frame,
-                        Bifrost::Math::float3&       value) {
+bool get_attribute_data(const AttributeReader& attribute,
+                        const float            frame,
+                        Bifrost::Math::float3& value) {
     value          = Bifrost::Math::float3(); // set default
-    auto type_name = attribute->GetTypeName();
+    auto type_name = attribute.GetTypeName();
     if (type_name == PXR_NS::SdfValueTypeNames->Half3) {
         PXR_NS::GfVec3h result;
-        bool success = attribute->Get(&result, static_cast<double>(frame));
+        bool success = attribute.Get(&result, static_cast<double>(frame));
         if (success) {
             value.x = result[0];
             value.y = result[1];
@@ -390,19 +422,19 @@ bool get_attribute_data(const BifrostUsd::Attribute& attribute,
     }
 
     PxrType_t<Bifrost::Math::float3> result;
-    bool success = attribute->Get(&result, static_cast<double>(frame));
+    bool success = attribute.Get(&result, static_cast<double>(frame));
     if (success) value = fromPxr(result);
     return success;
 }
 template <>
-bool get_attribute_data(const BifrostUsd::Attribute&         attribute,
+bool get_attribute_data(const AttributeReader&               attribute,
                         const float                          frame,
                         Amino::Array<Bifrost::Math::float3>& value) {
     value          = Amino::Array<Bifrost::Math::float3>(); // set default
-    auto type_name = attribute->GetTypeName();
+    auto type_name = attribute.GetTypeName();
     if (type_name == PXR_NS::SdfValueTypeNames->Half3Array) {
         PXR_NS::VtVec3hArray result;
-        bool success = attribute->Get(&result, static_cast<double>(frame));
+        bool success = attribute.Get(&result, static_cast<double>(frame));
         if (success) {
             auto out = Amino::Array<Bifrost::Math::float3>(result.size());
             for (unsigned i = 0; i < result.size(); ++i) {
@@ -417,19 +449,19 @@ bool get_attribute_data(const BifrostUsd::Attribute&         attribute,
     }
 
     PxrType_t<Amino::Array<Bifrost::Math::float3>> result;
-    bool success = attribute->Get(&result, static_cast<double>(frame));
+    bool success = attribute.Get(&result, static_cast<double>(frame));
     if (success) value = fromPxr(result);
     return success;
 }
 template <>
-bool get_attribute_data(const BifrostUsd::Attribute& attribute,
-                        const float                  frame,
-                        Bifrost::Math::float4&       value) {
+bool get_attribute_data(const AttributeReader& attribute,
+                        const float            frame,
+                        Bifrost::Math::float4& value) {
     value          = Bifrost::Math::float4(); // set default
-    auto type_name = attribute->GetTypeName();
+    auto type_name = attribute.GetTypeName();
     if (type_name == PXR_NS::SdfValueTypeNames->Quatf) {
         PXR_NS::GfQuatf result;
-        bool success = attribute->Get(&result, static_cast<double>(frame));
+        bool success = attribute.Get(&result, static_cast<double>(frame));
         if (success) {
             auto const& imaginary = result.GetImaginary();
             value.w               = result.GetReal();
@@ -441,7 +473,7 @@ bool get_attribute_data(const BifrostUsd::Attribute& attribute,
 
     } else if (type_name == PXR_NS::SdfValueTypeNames->Quath) {
         PXR_NS::GfQuath result;
-        bool success = attribute->Get(&result, static_cast<double>(frame));
+        bool success = attribute.Get(&result, static_cast<double>(frame));
         if (success) {
             auto const& imaginary = result.GetImaginary();
             value.w               = result.GetReal();
@@ -452,7 +484,7 @@ bool get_attribute_data(const BifrostUsd::Attribute& attribute,
         return success;
     } else if (type_name == PXR_NS::SdfValueTypeNames->Half4) {
         PXR_NS::GfVec4h result;
-        bool success = attribute->Get(&result, static_cast<double>(frame));
+        bool success = attribute.Get(&result, static_cast<double>(frame));
         if (success) {
             value.x = result[0];
             value.y = result[1];
@@ -463,19 +495,19 @@ bool get_attribute_data(const BifrostUsd::Attribute& attribute,
     }
 
     PxrType_t<Bifrost::Math::float4> result;
-    bool success = attribute->Get(&result, static_cast<double>(frame));
+    bool success = attribute.Get(&result, static_cast<double>(frame));
     if (success) value = fromPxr(result);
     return success;
 }
 template <>
-bool get_attribute_data(const BifrostUsd::Attribute&         attribute,
+bool get_attribute_data(const AttributeReader&               attribute,
                         const float                          frame,
                         Amino::Array<Bifrost::Math::float4>& value) {
     value          = Amino::Array<Bifrost::Math::float4>(); // set default
-    auto type_name = attribute->GetTypeName();
+    auto type_name = attribute.GetTypeName();
     if (type_name == PXR_NS::SdfValueTypeNames->QuatfArray) {
         PXR_NS::VtQuatfArray result;
-        bool success = attribute->Get(&result, static_cast<double>(frame));
+        bool success = attribute.Get(&result, static_cast<double>(frame));
         if (success) {
             auto out = Amino::Array<Bifrost::Math::float4>(result.size());
             for (unsigned i = 0; i < result.size(); ++i) {
@@ -491,7 +523,7 @@ bool get_attribute_data(const BifrostUsd::Attribute&         attribute,
         return success;
     } else if (type_name == PXR_NS::SdfValueTypeNames->QuathArray) {
         PXR_NS::VtQuathArray result;
-        bool success = attribute->Get(&result, static_cast<double>(frame));
+        bool success = attribute.Get(&result, static_cast<double>(frame));
         if (success) {
             auto out = Amino::Array<Bifrost::Math::float4>(result.size());
             for (unsigned i = 0; i < result.size(); ++i) {
@@ -507,7 +539,7 @@ bool get_attribute_data(const BifrostUsd::Attribute&         attribute,
         return success;
     } else if (type_name == PXR_NS::SdfValueTypeNames->Half4Array) {
         PXR_NS::VtVec4hArray result;
-        bool success = attribute->Get(&result, static_cast<double>(frame));
+        bool success = attribute.Get(&result, static_cast<double>(frame));
         if (success) {
             auto out = Amino::Array<Bifrost::Math::float4>(result.size());
             for (unsigned i = 0; i < result.size(); ++i) {
@@ -523,19 +555,19 @@ bool get_attribute_data(const BifrostUsd::Attribute&         attribute,
     }
 
     PxrType_t<Amino::Array<Bifrost::Math::float4>> result;
-    bool success = attribute->Get(&result, static_cast<double>(frame));
+    bool success = attribute.Get(&result, static_cast<double>(frame));
     if (success) value = fromPxr(result);
     return success;
 }
 template <>
-bool get_attribute_data(const BifrostUsd::Attribute& attribute,
-                        const float                    frame,
-                        Bifrost::Math::double4&        value) {
+bool get_attribute_data(const AttributeReader&  attribute,
+                        const float             frame,
+                        Bifrost::Math::double4& value) {
     value          = Bifrost::Math::double4(); // set default
-    auto type_name = attribute->GetTypeName();
+    auto type_name = attribute.GetTypeName();
     if (type_name == PXR_NS::SdfValueTypeNames->Quatd) {
         PXR_NS::GfQuatd result;
-        bool success = attribute->Get(&result, static_cast<double>(frame));
+        bool success = attribute.Get(&result, static_cast<double>(frame));
         if (success) {
             auto const& imaginary = result.GetImaginary();
             value.w               = result.GetReal();
@@ -547,19 +579,19 @@ bool get_attribute_data(const BifrostUsd::Attribute& attribute,
     }
 
     PxrType_t<Bifrost::Math::double4> result;
-    bool success = attribute->Get(&result, static_cast<double>(frame));
+    bool success = attribute.Get(&result, static_cast<double>(frame));
     if (success) value = fromPxr(result);
     return success;
 }
 template <>
-bool get_attribute_data(const BifrostUsd::Attribute&        attribute,
+bool get_attribute_data(const AttributeReader&                attribute,
                         const float                           frame,
                         Amino::Array<Bifrost::Math::double4>& value) {
     value          = Amino::Array<Bifrost::Math::double4>(); // set default
-    auto type_name = attribute->GetTypeName();
+    auto type_name = attribute.GetTypeName();
     if (type_name == PXR_NS::SdfValueTypeNames->QuatdArray) {
         PXR_NS::VtQuatdArray result;
-        bool success = attribute->Get(&result, static_cast<double>(frame));
+        bool success = attribute.Get(&result, static_cast<double>(frame));
         if (success) {
             auto out = Amino::Array<Bifrost::Math::double4>(result.size());
             for (unsigned i = 0; i < result.size(); ++i) {
@@ -576,7 +608,7 @@ bool get_attribute_data(const BifrostUsd::Attribute&        attribute,
     }
 
     PxrType_t<Amino::Array<Bifrost::Math::double4>> result;
-    bool success = attribute->Get(&result, static_cast<double>(frame));
+    bool success = attribute.Get(&result, static_cast<double>(frame));
     if (success) value = fromPxr(result);
     return success;
 }
@@ -586,7 +618,8 @@ bool get_prim_attribute_data_impl(const BifrostUsd::Attribute& attribute,
                                   DESTTYPE&                      value) {
     if (!attribute) return false;
     try {
-        return get_attribute_data(attribute, frame, value);
+        return get_attribute_data(AttributeReader(*attribute.operator->()),
+                                  frame, value);
     } catch (std::exception& e) {
         log_exception("get_prim_attribute_data", e);
     }
@@ -624,15 +657,207 @@ FOR_EACH_SUPPORTED_ARRAY_ATTRIBUTE(IMPLEMENT_GET_PRIM_ATTRIBUTE_DATA)
 
 namespace {
 template <typename TYPE>
-bool set_attribute(PXR_NS::UsdAttribute& pxr_attribute,
-                   const TYPE&        value,
-                   PXR_NS::UsdTimeCode   time) {
+void set_default_sample(TYPE&) {}
+template <typename TYPE>
+bool get_attribute_sample(const AttributeReader& reader,
+                          const float            frame,
+                          TYPE&                  value) {
+    return get_attribute_data(reader, frame, value);
+}
+/// Array attributes are read in their own array for each sample. Samples that
+/// are not read are empty arrays rather than null pointers.
+template <typename TYPE>
+void set_default_sample(Amino::Ptr<Amino::Array<TYPE>>& value) {
+    value = Amino::newClassPtr<Amino::Array<TYPE>>();
+}
+template <typename TYPE>
+bool get_attribute_sample(const AttributeReader&          reader,
+                          const float                     frame,
+                          Amino::Ptr<Amino::Array<TYPE>>& value) {
+    auto array   = Amino::newMutablePtr<Amino::Array<TYPE>>();
+    bool success = get_attribute_data(reader, frame, *array);
+    value        = array.toImmutable();
+    return success;
+}
+
+template <typename TYPE>
+bool get_prim_attribute_samples_impl(
+    const BifrostUsd::Stage&               stage,
+    const Amino::Array<Amino::String>&     prim_paths,
+    const Amino::Array<Amino::String>&     attribute_names,
+    const Amino::Array<float>&             frames,
+    Amino::MutablePtr<Amino::Array<TYPE>>& values,
+    Amino::MutablePtr<Amino::Array<bool>>& found) {
+    const size_t numPrims      = prim_paths.size();
+    const size_t numAttributes = attribute_names.size();
+    const size_t numFrames     = frames.size();
+    const size_t numQueries    = numPrims * numAttributes;
+
+    values = Amino::newMutablePtr<Amino::Array<TYPE>>();
+    found  = Amino::newMutablePtr<Amino::Array<bool>>();
+    if (!stage) return false;
+
+    try {
+        std::vector<PXR_NS::TfToken> names(numAttributes);
+        for (size_t a = 0; a < numAttributes; ++a) {
+            names[a] = PXR_NS::TfToken(attribute_names[a].c_str());
+        }
+
+        std::vector<PXR_NS::UsdPrim> prims(numPrims);
+        PXR_NS::WorkParallelForN(numPrims, [&](size_t begin, size_t end) {
+            for (size_t p = begin; p < end; ++p) {
+                prims[p] = get_prim_at_path(prim_paths[p], stage);
+            }
+        });
+
+        // Each query reads all its frames into its own range of the values.
+        values->resize(numQueries * numFrames);
+        std::vector<char> queryFound(numQueries, 0);
+        PXR_NS::WorkParallelForN(numQueries, [&](size_t begin, size_t end) {
+            for (size_t q = begin; q < end; ++q) {
+                for (size_t f = 0; f < numFrames; ++f) {
+                    set_default_sample((*values)[q * numFrames + f]);
+                }
+                const auto& prim = prims[q / numAttributes];
+                if (!prim) continue;
+                try {
+                    const PXR_NS::UsdAttributeQuery query(
+                        prim.GetAttribute(names[q % numAttributes]));
+                    if (!query.IsValid()) continue;
+                    const AttributeReader reader(query);
+                    bool success = true;
+                    for (size_t f = 0; f < numFrames; ++f) {
+                        success &= get_attribute_sample(
+                            reader, frames[f], (*values)[q * numFrames + f]);
+                    }
+                    queryFound[q] = success;
+                } catch (std::exception& e) {
+                    log_exception("get_prim_attribute_samples", e);
+                }
+            }
+        });
+
+        found->resize(numQueries);
+        for (size_t q = 0; q < numQueries; ++q) {
+            (*found)[q] = queryFound[q] != 0;
+        }
+        return std::all_of(queryFound.begin(), queryFound.end(),
+                           [](char f) { return f != 0; });
+    } catch (std::exception& e) {
+        log_exception("get_prim_attribute_samples", e);
+    }
+    return false;
+}
+} // namespace
+
+#define IMPLEMENT_GET_PRIM_ATTRIBUTE_SAMPLES(TYPE)                          \
+    bool USD::Attribute::get_prim_attribute_samples(                        \
+        const BifrostUsd::Stage& stage,                                     \
+        const Amino::Array<Amino::String>& prim_paths,                      \
+        const Amino::Array<Amino::String>& attribute_names,                 \
+        const Amino::Array<float>& frames, TYPE,                            \
+        Amino::MutablePtr<Amino::Array<TYPE>>& values,                      \
+        Amino::MutablePtr<Amino::Array<bool>>& found) {                     \
+        return get_prim_attribute_samples_impl(stage, prim_paths,           \
+                                               attribute_names, frames,     \
+                                               values, found);              \
+    }
+FOR_EACH_SUPPORTED_BUILTIN_ATTRIBUTE(IMPLEMENT_GET_PRIM_ATTRIBUTE_SAMPLES)
+#undef IMPLEMENT_GET_PRIM_ATTRIBUTE_SAMPLES
+
+#define IMPLEMENT_GET_PRIM_ATTRIBUTE_SAMPLES(TYPE)                          \
+    bool USD::Attribute::get_prim_attribute_samples(                        \
+        const BifrostUsd::Stage& stage,                                     \
+        const Amino::Array<Amino::String>& prim_paths,                      \
+        const Amino::Array<Amino::String>& attribute_names,                 \
+        const Amino::Array<float>& frames, const TYPE&,                     \
+        Amino::MutablePtr<Amino::Array<TYPE>>& values,                      \
+        Amino::MutablePtr<Amino::Array<bool>>& found) {                     \
+        return get_prim_attribute_samples_impl(stage, prim_paths,           \
+                                               attribute_names, frames,     \
+                                               values, found);              \
+    }
+FOR_EACH_SUPPORTED_STRUCT_ATTRIBUTE(IMPLEMENT_GET_PRIM_ATTRIBUTE_SAMPLES)
+#undef IMPLEMENT_GET_PRIM_ATTRIBUTE_SAMPLES
+
+#define IMPLEMENT_GET_PRIM_ATTRIBUTE_SAMPLES(TYPE)                          \
+    bool USD::Attribute::get_prim_attribute_samples(                        \
+        const BifrostUsd::Stage& stage,                                     \
+        const Amino::Array<Amino::String>& prim_paths,                      \
+        const Amino::Array<Amino::String>& attribute_names,                 \
+        const Amino::Array<float>& frames, const Amino::Array<TYPE>&,       \
+        Amino::MutablePtr<Amino::Array<Amino::Ptr<Amino::Array<TYPE>>>>&    \
+                                               values,                      \
+        Amino::MutablePtr<Amino::Array<bool>>& found) {                     \
+        return get_prim_attribute_samples_impl(stage, prim_paths,           \
+                                               attribute_names, frames,     \
+                                               values, found);              \
+    }
+FOR_EACH_SUPPORTED_ARRAY_ATTRIBUTE(IMPLEMENT_GET_PRIM_ATTRIBUTE_SAMPLES)
+#undef IMPLEMENT_GET_PRIM_ATTRIBUTE_SAMPLES
+
+namespace {
+/// Writes the values of an attribute, either through the UsdAttribute, or
+/// directly in the attribute spec of a layer. Writing in the layer does not
+/// use the Usd API, so it can be done within an SdfChangeBlock, provided the
+/// writer was created before the change block.
+class AttributeWriter {
+public:
+    explicit AttributeWriter(const PXR_NS::UsdAttribute& attribute)
+        : m_attribute(attribute), m_typeName(attribute.GetTypeName()) {}
+    AttributeWriter(const PXR_NS::UsdAttribute&   attribute,
+                    const PXR_NS::SdfLayerHandle& layer)
+        : m_attribute(attribute),
+          m_typeName(attribute.GetTypeName()),
+          m_layer(layer),
+          m_variability(attribute.GetVariability()),
+          m_custom(attribute.IsCustom()) {}
+
+    const PXR_NS::SdfValueTypeName& GetTypeName() const { return m_typeName; }
+
+    template <typename T>
+    bool Set(const T& value, PXR_NS::UsdTimeCode time) const {
+        if (!m_layer) return m_attribute.Set(value, time);
+
+        // The Usd API would refuse a value of the wrong type, Sdf does not.
+        if (PXR_NS::TfType::Find<T>() != m_typeName.GetType()) {
+            return false;
+        }
+        const auto& path = m_attribute.GetPath();
+        auto        spec = m_layer->GetAttributeAtPath(path);
+        if (!spec) {
+            auto primSpec =
+                PXR_NS::SdfCreatePrimInLayer(m_layer, path.GetPrimPath());
+            if (!primSpec) return false;
+            spec = PXR_NS::SdfAttributeSpec::New(
+                primSpec, path.GetName(), m_typeName, m_variability, m_custom);
+            if (!spec) return false;
+        }
+        if (time.IsDefault()) {
+            return spec->SetDefaultValue(PXR_NS::VtValue(value));
+        }
+        m_layer->SetTimeSample(path, time.GetValue(), value);
+        return true;
+    }
+
+private:
+    const PXR_NS::UsdAttribute& m_attribute;
+    PXR_NS::SdfValueTypeName    m_typeName;
+    PXR_NS::SdfLayerHandle      m_layer;
+    PXR_NS::SdfVariability      m_variability = PXR_NS::SdfVariabilityVarying;
+    bool                        m_custom      = false;
+};
+
+template <typename TYPE>
+bool set_attribute(const AttributeWriter& pxr_attribute,
+                   const TYPE&            value,
+                   PXR_NS::UsdTimeCode    time) {
     return pxr_attribute.Set(toPxr(value), time);
 }
 template <>
-bool set_attribute(PXR_NS::UsdAttribute&   pxr_attribute,
-                   const Amino::String& value,
-                   PXR_NS::UsdTimeCode     time) {
+bool set_attribute(const AttributeWriter& pxr_attribute,
+                   const Amino::String&   value,
+                   PXR_NS::UsdTimeCode    time) {
     auto type_name = pxr_attribute.GetTypeName();
     // set as asset, token or regular string
     if (type_name == PXR_NS::SdfValueTypeNames->Asset) {
@@ -643,9 +868,9 @@ bool set_attribute(PXR_NS::UsdAttribute&   pxr_attribute,
     return pxr_attribute.Set(toPxr(value), time);
 }
 template <>
-bool set_attribute(PXR_NS::UsdAttribute&                 pxr_attribute,
+bool set_attribute(const AttributeWriter&             pxr_attribute,
                    const Amino::Array<Amino::String>& value,
-                   PXR_NS::UsdTimeCode                   time) {
+                   PXR_NS::UsdTimeCode                time) {
     auto type_name = pxr_attribute.GetTypeName();
     // set as asset array, token array or regular string array
     if (type_name == PXR_NS::SdfValueTypeNames->AssetArray) {
@@ -666,9 +891,9 @@ bool set_attribute(PXR_NS::UsdAttribute&                 pxr_attribute,
     return pxr_attribute.Set(toPxr(value), time);
 }
 template <>
-bool set_attribute(PXR_NS::UsdAttribute& pxr_attribute,
-                   const float&       value,
-                   PXR_NS::UsdTimeCode   time) {
+bool set_attribute(const AttributeWriter& pxr_attribute,
+                   const float&           value,
+                   PXR_NS::UsdTimeCode    time) {
     auto type_name = pxr_attribute.GetTypeName();
     // Set as half or other float types
     if (type_name == PXR_NS::SdfValueTypeNames->Half) {
@@ -678,9 +903,9 @@ bool set_attribute(PXR_NS::UsdAttribute& pxr_attribute,
     return pxr_attribute.Set(toPxr(value), time);
 }
 template <>
-bool set_attribute(PXR_NS::UsdAttribute&         pxr_attribute,
+bool set_attribute(const AttributeWriter&     pxr_attribute,
                    const Amino::Array<float>& value,
-                   PXR_NS::UsdTimeCode           time) {
+                   PXR_NS::UsdTimeCode        time) {
     auto type_name = pxr_attribute.GetTypeName();
     // Set as HalfArray or regular floatArray
     if ( type_name == PXR_NS::SdfValueTypeNames->HalfArray) {
@@ -693,9 +918,9 @@ bool set_attribute(PXR_NS::UsdAttribute&         pxr_attribute,
     return pxr_attribute.Set(toPxr(value), time);
 }
 template <>
-bool set_attribute(PXR_NS::UsdAttribute&           pxr_attribute,
+bool set_attribute(const AttributeWriter&       pxr_attribute,
                    const Bifrost::Math::float2& value,
-                   PXR_NS::UsdTimeCode             time) {
+                   PXR_NS::UsdTimeCode          time) {
     auto type_name = pxr_attribute.GetTypeName();
     if (type_name == PXR_NS::SdfValueTypeNames->Half2) {
         auto pxr_value = PXR_NS::GfVec2h(value.x, value.y);
@@ -704,9 +929,9 @@ bool set_attribute(PXR_NS::UsdAttribute&           pxr_attribute,
     return pxr_attribute.Set(toPxr(value), time);
 }
 template <>
-bool set_attribute(PXR_NS::UsdAttribute&                         pxr_attribute,
+bool set_attribute(const AttributeWriter&                     pxr_attribute,
                    const Amino::Array<Bifrost::Math::float2>& value,
-                   PXR_NS::UsdTimeCode                           time) {
+                   PXR_NS::UsdTimeCode                        time) {
     auto type_name = pxr_attribute.GetTypeName();
     // Set as half2 or other float2 array based types
     if ( type_name == PXR_NS::SdfValueTypeNames->Half2Array) {
@@ -720,9 +945,9 @@ bool set_attribute(PXR_NS::UsdAttribute&                         pxr_attribute,
     return pxr_attribute.Set(toPxr(value), time);
 }
 template <>
-bool set_attribute(PXR_NS::UsdAttribute&           pxr_attribute,
+bool set_attribute(const AttributeWriter&       pxr_attribute,
                    const Bifrost::Math::float3& value,
-                   PXR_NS::UsdTimeCode             time) {
+                   PXR_NS::UsdTimeCode          time) {
     auto type_name = pxr_attribute.GetTypeName();
     // Set as half3 or other float3 based types
     if (type_name == PXR_NS::SdfValueTypeNames->Half3) {
@@ -732,9 +957,9 @@ bool set_attribute(PXR_NS::UsdAttribute&           pxr_attribute,
     return pxr_attribute.Set(toPxr(value), time);
 }
 template <>
-bool set_attribute(PXR_NS::UsdAttribute&                         pxr_attribute,
+bool set_attribute(const AttributeWriter&                     pxr_attribute,
                    const Amino::Array<Bifrost::Math::float3>& value,
-                   PXR_NS::UsdTimeCode                           time) {
+                   PXR_NS::UsdTimeCode                        time) {
     auto type_name = pxr_attribute.GetTypeName();
     // Set as half3Array or other float3 array based types
     if ( type_name == PXR_NS::SdfValueTypeNames->Half3Array) {
@@ -748,9 +973,9 @@ bool set_attribute(PXR_NS::UsdAttribute&                         pxr_attribute,
     return pxr_attribute.Set(toPxr(value), time);
 }
 template <>
-bool set_attribute(PXR_NS::UsdAttribute&           pxr_attribute,
+bool set_attribute(const AttributeWriter&       pxr_attribute,
                    const Bifrost::Math::float4& value,
-                   PXR_NS::UsdTimeCode             time) {
+                   PXR_NS::UsdTimeCode          time) {
     auto type_name = pxr_attribute.GetTypeName();
     // set as quaternion or regular vec4 array
     if (type_name == PXR_NS::SdfValueTypeNames->Quatf) {
@@ -766,9 +991,9 @@ bool set_attribute(PXR_NS::UsdAttribute&           pxr_attribute,
     return pxr_attribute.Set(toPxr(value), time);
 }
 template <>
-bool set_attribute(PXR_NS::UsdAttribute&                         pxr_attribute,
+bool set_attribute(const AttributeWriter&                     pxr_attribute,
                    const Amino::Array<Bifrost::Math::float4>& value,
-                   PXR_NS::UsdTimeCode                           time) {
+                   PXR_NS::UsdTimeCode                        time) {
     auto type_name = pxr_attribute.GetTypeName();
     // set as quaternion or regular vec4 array
     if (type_name == PXR_NS::SdfValueTypeNames->QuatfArray) {
@@ -798,9 +1023,9 @@ bool set_attribute(PXR_NS::UsdAttribute&                         pxr_attribute,
     return false;
 }
 template <>
-bool set_attribute(PXR_NS::UsdAttribute&            pxr_attribute,
+bool set_attribute(const AttributeWriter&        pxr_attribute,
                    const Bifrost::Math::double4& value,
-                   PXR_NS::UsdTimeCode              time) {
+                   PXR_NS::UsdTimeCode           time) {
     auto type_name = pxr_attribute.GetTypeName();
     // set as quaternion or regular vec4 array
     if (type_name == PXR_NS::SdfValueTypeNames->Quatd) {
@@ -810,9 +1035,9 @@ bool set_attribute(PXR_NS::UsdAttribute&            pxr_attribute,
     return pxr_attribute.Set(toPxr(value), time);
 }
 template <>
-bool set_attribute(PXR_NS::UsdAttribute&                          pxr_attribute,
+bool set_attribute(const AttributeWriter&                      pxr_attribute,
                    const Amino::Array<Bifrost::Math::double4>& value,
-                   PXR_NS::UsdTimeCode                            time) {
+                   PXR_NS::UsdTimeCode                         time) {
     auto type_name = pxr_attribute.GetTypeName();
     // set as quaternion or regular vec4 array
     if (type_name == PXR_NS::SdfValueTypeNames->QuatdArray) {
@@ -842,7 +1067,7 @@ bool set_prim_attribute_impl(const Amino::String& prim_path,
         if (!pxr_attribute) return false;
         auto time = use_frame ? PXR_NS::UsdTimeCode(static_cast<double>(frame))
                               : PXR_NS::UsdTimeCode::Default();
-        return set_attribute(pxr_attribute, value, time);
+        return set_attribute(AttributeWriter(pxr_attribute), value, time);
     } catch (std::exception& e) {
         log_exception("get_prim_attribute_data", e);
     }
@@ -886,6 +1111,84 @@ FOR_EACH_SUPPORTED_ARRAY_ATTRIBUTE(IMPLEMENT_SET_PRIM_ATTRIBUTE)
 #undef IMPLEMENT_SET_PRIM_ATTRIBUTE
 /// \endcond
 
+namespace {
+template <typename TYPE>
+bool set_prims_attribute_impl(const Amino::Array<Amino::String>& prim_paths,
+                              const Amino::String&               name,
+                              const Amino::Array<TYPE>&          values,
+                              const bool                         use_frame,
+                              const float                        frame,
+                              BifrostUsd::Stage&                 stage) {
+    if (!stage) return false;
+    if (prim_paths.size() != values.size()) return false;
+    try {
+        VariantEditContext ctx(stage);
+
+        // All the attributes are resolved before authoring anything, since
+        // the Usd API can't be used within an SdfChangeBlock.
+        const PXR_NS::TfToken             attributeName(name.c_str());
+        std::vector<PXR_NS::UsdAttribute> attributes;
+        std::vector<size_t>               valueIndices;
+        attributes.reserve(prim_paths.size());
+        valueIndices.reserve(prim_paths.size());
+        for (size_t i = 0; i < prim_paths.size(); ++i) {
+            auto pxr_prim = get_prim_at_path(prim_paths[i], stage);
+            if (!pxr_prim) continue;
+            auto pxr_attribute = pxr_prim.GetAttribute(attributeName);
+            if (!pxr_attribute) continue;
+            attributes.push_back(std::move(pxr_attribute));
+            valueIndices.push_back(i);
+        }
+
+        auto time = use_frame ? PXR_NS::UsdTimeCode(static_cast<double>(frame))
+                              : PXR_NS::UsdTimeCode::Default();
+        bool success = attributes.size() == prim_paths.size();
+
+        // When the edit target maps paths and times to the layer unchanged,
+        // the values are authored directly in the layer, so that the stage
+        // processes a single change notification.
+        const auto editTarget = stage->GetEditTarget();
+        if (editTarget.GetMapFunction().IsIdentity()) {
+            const auto                   layer = editTarget.GetLayer();
+            std::vector<AttributeWriter> writers;
+            writers.reserve(attributes.size());
+            for (const auto& pxr_attribute : attributes) {
+                writers.emplace_back(pxr_attribute, layer);
+            }
+            PXR_NS::SdfChangeBlock changeBlock;
+            for (size_t i = 0; i < writers.size(); ++i) {
+                success &=
+                    set_attribute(writers[i], values[valueIndices[i]], time);
+            }
+        } else {
+            for (size_t i = 0; i < attributes.size(); ++i) {
+                success &= set_attribute(AttributeWriter(attributes[i]),
+                                         values[valueIndices[i]], time);
+            }
+        }
+        return success;
+    } catch (std::exception& e) {
+        log_exception("set_prims_attribute", e);
+    }
+    return false;
+}
+} // namespace
+
+/// \cond false
+#define IMPLEMENT_SET_PRIMS_ATTRIBUTE(TYPE)                                  \
+    bool USD::Attribute::set_prims_attribute(                                \
+        BifrostUsd::Stage&                 stage,                            \
+        const Amino::Array<Amino::String>& prim_paths,                       \
+        const Amino::String& name, const Amino::Array<TYPE>& values,         \
+        const bool use_frame, const float frame) {                           \
+        return set_prims_attribute_impl(prim_paths, name, values, use_frame, \
+                                        frame, stage);                       \
+    }
+FOR_EACH_SUPPORTED_BUILTIN_ATTRIBUTE(IMPLEMENT_SET_PRIMS_ATTRIBUTE)
+FOR_EACH_SUPPORTED_STRUCT_ATTRIBUTE(IMPLEMENT_SET_PRIMS_ATTRIBUTE)
+#undef IMPLEMENT_SET_PRIMS_ATTRIBUTE
+/// \endcond
+
 bool USD::Attribute::add_attribute_connection(
     BifrostUsd::Stage&                stage,
     const Amino::String&                prim_path,
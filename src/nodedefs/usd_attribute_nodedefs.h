@@ -240,6 +240,73 @@ FOR_EACH_SUPPORTED_STRUCT_ATTRIBUTE(DECLARE_GET_PRIM_ATTRIBUTE_DATA)
 FOR_EACH_SUPPORTED_ARRAY_ATTRIBUTE(DECLARE_GET_PRIM_ATTRIBUTE_DATA)
 #undef DECLARE_GET_PRIM_ATTRIBUTE_DATA
 
+/// \ingroup Attribute
+/// \defgroup get_prim_attribute_samples get_prim_attribute_samples node
+///
+/// \brief This node reads several attributes, on several prims, at several
+/// frames in a single evaluation.
+///
+/// Each attribute is resolved once, and its values at all the frames are read
+/// through a USD attribute query. The attributes are read in parallel.
+///
+/// \param [in] stage The stage from which to read the attributes.
+/// \param [in] prim_paths The paths of the prims to read.
+/// \param [in] attribute_names The names of the attributes to read on each
+///             prim.
+/// \param [in] frames The frames at which to read each attribute.
+/// \param [in] type The type of the data.
+/// \param [out] values The values, packed by prim, then by attribute, then by
+///             frame. The value of attribute \c a of prim \c p at frame \c f
+///             is at index <tt>(p * num_attributes + a) * num_frames + f</tt>.
+///             Values that could not be read are set to the default value of
+///             the type. For array attributes, each value is the array read
+///             at that frame, empty if it could not be read.
+/// \param [out] found For each prim and attribute, packed by prim, whether
+///             the attribute exists and all its values were read.
+/// \returns true if all the values were successfully read.
+#define DECLARE_GET_PRIM_ATTRIBUTE_SAMPLES(TYPE)                    \
+    USD_NODEDEF_DECL bool get_prim_attribute_samples(               \
+        const BifrostUsd::Stage&           stage,                   \
+        const Amino::Array<Amino::String>& prim_paths,              \
+        const Amino::Array<Amino::String>& attribute_names,         \
+        const Amino::Array<float>& frames, TYPE type,               \
+        Amino::MutablePtr<Amino::Array<TYPE>>& values,              \
+        Amino::MutablePtr<Amino::Array<bool>>& found)               \
+        USDNODE_DOC_ICON_X("get_prim_attribute_samples",            \
+                           "get_prim_attribute_samples", "usd.svg", \
+                           "outName=success");
+FOR_EACH_SUPPORTED_BUILTIN_ATTRIBUTE(DECLARE_GET_PRIM_ATTRIBUTE_SAMPLES)
+#undef DECLARE_GET_PRIM_ATTRIBUTE_SAMPLES
+
+#define DECLARE_GET_PRIM_ATTRIBUTE_SAMPLES(TYPE)                    \
+    USD_NODEDEF_DECL bool get_prim_attribute_samples(               \
+        const BifrostUsd::Stage&           stage,                   \
+        const Amino::Array<Amino::String>& prim_paths,              \
+        const Amino::Array<Amino::String>& attribute_names,         \
+        const Amino::Array<float>& frames, const TYPE& type,        \
+        Amino::MutablePtr<Amino::Array<TYPE>>& values,              \
+        Amino::MutablePtr<Amino::Array<bool>>& found)               \
+        USDNODE_DOC_ICON_X("get_prim_attribute_samples",            \
+                           "get_prim_attribute_samples", "usd.svg", \
+                           "outName=success");
+FOR_EACH_SUPPORTED_STRUCT_ATTRIBUTE(DECLARE_GET_PRIM_ATTRIBUTE_SAMPLES)
+#undef DECLARE_GET_PRIM_ATTRIBUTE_SAMPLES
+
+#define DECLARE_GET_PRIM_ATTRIBUTE_SAMPLES(TYPE)                          \
+    USD_NODEDEF_DECL bool get_prim_attribute_samples(                     \
+        const BifrostUsd::Stage&           stage,                         \
+        const Amino::Array<Amino::String>& prim_paths,                    \
+        const Amino::Array<Amino::String>& attribute_names,               \
+        const Amino::Array<float>& frames, const Amino::Array<TYPE>& type, \
+        Amino::MutablePtr<Amino::Array<Amino::Ptr<Amino::Array<TYPE>>>>&  \
+                                               values,                    \
+        Amino::MutablePtr<Amino::Array<bool>>& found)                     \
+        USDNODE_DOC_ICON_X("get_prim_attribute_samples",                  \
+                           "get_prim_attribute_samples", "usd.svg",       \
+                           "outName=success");
+FOR_EACH_SUPPORTED_ARRAY_ATTRIBUTE(DECLARE_GET_PRIM_ATTRIBUTE_SAMPLES)
+#undef DECLARE_GET_PRIM_ATTRIBUTE_SAMPLES
+
 /// \ingroup Attribute
 /// \defgroup set_prim_attribute set_prim_attribute node
 ///
@@ -284,6 +351,36 @@ FOR_EACH_SUPPORTED_STRUCT_ATTRIBUTE(DECLARE_SET_PRIM_ATTRIBUTE_DATA)
 FOR_EACH_SUPPORTED_ARRAY_ATTRIBUTE(DECLARE_SET_PRIM_ATTRIBUTE_DATA)
 #undef DECLARE_SET_PRIM_ATTRIBUTE_DATA
 
+/// \ingroup Attribute
+/// \defgroup set_prims_attribute set_prims_attribute node
+///
+/// \brief This node sets the value of an attribute on several prims.
+///
+/// All the values are authored at once, so that the stage processes a single
+/// change notification, instead of one per prim.
+///
+/// \param [in] prim_paths The paths of the prims on which to set the
+///             attribute.
+/// \param [in] name The name of the attribute. It must already exist on all
+///             the prims.
+/// \param [in] values The values to set, one per prim path.
+/// \param [in] use_frame If enabled, sets the attribute at the given frame.
+/// \param [in] frame The frame at which to set the attribute data.
+/// \param [out] new_stage The new stage with the modified attributes.
+/// \returns true if the attribute was set on all the prims. Nothing is set if
+///             the number of values does not match the number of prims.
+#define DECLARE_SET_PRIMS_ATTRIBUTE(TYPE)                              \
+    USD_NODEDEF_DECL bool set_prims_attribute(                         \
+        BifrostUsd::Stage& stage USDPORT_INOUT("out_stage"),           \
+        const Amino::Array<Amino::String>& prim_paths,                 \
+        const Amino::String& name, const Amino::Array<TYPE>& values,   \
+        const bool use_frame, const float frame FRAME_ANNOTATION)      \
+        USDNODE_DOC_ICON_X("set_prims_attribute", "set_prims_attribute", \
+                           "usd.svg", "outName=success");
+FOR_EACH_SUPPORTED_BUILTIN_ATTRIBUTE(DECLARE_SET_PRIMS_ATTRIBUTE)
+FOR_EACH_SUPPORTED_STRUCT_ATTRIBUTE(DECLARE_SET_PRIMS_ATTRIBUTE)
+#undef DECLARE_SET_PRIMS_ATTRIBUTE
+
 /// \ingroup Attribute
 /// \defgroup add_attribute_connection add_attribute_connection node
 ///
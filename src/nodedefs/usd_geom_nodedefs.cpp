@@ -17,12 +17,20 @@
 #include "usd_geom_nodedefs.h"
 
 #include <Amino/Core/String.h>
+#include <Bifrost/Geometry/GeoProperty.h>
+#include <Bifrost/Geometry/Primitives.h>
+#include <pxr/base/work/loops.h>
 #include <pxr/usd/sdf/copyUtils.h>
 #include <pxr/usd/usd/editContext.h>
 #include <pxr/usd/usd/inherits.h>
 #include <pxr/usd/usd/references.h>
 
+#include <algorithm>
+#include <functional>
 #include <iostream>
+#include <numeric>
+#include <string>
+#include <vector>
 
 #include "logger.h"
 #include "return_guard.h"
@@ -33,9 +41,14 @@ BIFUSD_WARNING_PUSH
 BIFUSD_WARNING_DISABLE_MSC(4003)
 #include <pxr/usd/usd/modelAPI.h>
 #include <pxr/usd/usd/payloads.h>
+#include <pxr/usd/usd/primRange.h>
+#include <pxr/usd/usdGeom/basisCurves.h>
 #include <pxr/usd/usdGeom/boundable.h>
+#include <pxr/usd/usdGeom/curves.h>
 #include <pxr/usd/usdGeom/imageable.h>
+#include <pxr/usd/usdGeom/mesh.h>
 #include <pxr/usd/usdGeom/pointInstancer.h>
+#include <pxr/usd/usdGeom/primvarsAPI.h>
 #include <pxr/usd/usdGeom/xformCache.h>
 #include <pxr/usd/usdGeom/xformCommonAPI.h>
 #include <pxr/usd/usdVol/field3DAsset.h>
@@ -45,6 +58,660 @@ BIFUSD_WARNING_POP
 
 using namespace USDUtils;
 
+namespace {
+
+using BifrostIndices = Amino::Array<Bifrost::Geometry::Index>;
+
+const Amino::String kPrimPathProp("prim_path");
+const Amino::String kFaceVertexComp("face_vertex_component");
+const Amino::String kFaceVertexNormal("face_vertex_normal");
+const Amino::String kFaceVertexNormalIndex("face_vertex_normal_index");
+const Amino::String kFaceVertexUV("face_vertex_uv");
+const Amino::String kFaceVertexUVIndex("face_vertex_uv_index");
+const Amino::String kPointNormal("point_normal");
+const Amino::String kPointColor("point_color");
+const Amino::String kPointSize("point_size");
+
+/// Returns the prims of the given schema type found under the root prim
+/// (included), in traversal order. As with UsdStage::Traverse(), only the
+/// active, loaded, defined and non abstract prims are returned. The prims
+/// whose path starts with one of the excluded prefixes are skipped, along
+/// with their descendants.
+template <typename Schema>
+std::vector<PXR_NS::UsdPrim> collectPrims(
+    const PXR_NS::UsdPrim&             root,
+    const Amino::Array<Amino::String>& exclude_prefixes) {
+    std::vector<PXR_NS::UsdPrim> prims;
+    auto range = PXR_NS::UsdPrimRange(root, PXR_NS::UsdPrimDefaultPredicate);
+    for (auto it = range.begin(); it != range.end(); ++it) {
+        const std::string& path     = it->GetPath().GetString();
+        bool               excluded = false;
+        for (size_t i = 0; i < exclude_prefixes.size() && !excluded; ++i) {
+            const auto& prefix = exclude_prefixes[i];
+            excluded           = !prefix.empty() &&
+                       path.compare(0, prefix.size(), prefix.c_str()) == 0;
+        }
+        if (excluded) {
+            it.PruneChildren();
+        } else if (it->IsA<Schema>()) {
+            prims.push_back(*it);
+        }
+    }
+    return prims;
+}
+
+/// Returns the local to world transforms of the given prims. The transforms
+/// are computed serially, sharing a single cache, since the cache is not
+/// thread-safe.
+std::vector<PXR_NS::GfMatrix4d> computeLocalToWorldTransforms(
+    const std::vector<PXR_NS::UsdPrim>& prims,
+    const PXR_NS::UsdTimeCode           time) {
+    PXR_NS::UsdGeomXformCache       xformCache(time);
+    std::vector<PXR_NS::GfMatrix4d> xforms;
+    xforms.reserve(prims.size());
+    for (const auto& prim : prims) {
+        xforms.push_back(xformCache.GetLocalToWorldTransform(prim));
+    }
+    return xforms;
+}
+
+/// Returns, for each face vertex, the index of the primvar element that
+/// applies to it according to the primvar interpolation. Returns a null
+/// pointer if the number of elements does not match the interpolation.
+Amino::MutablePtr<BifrostIndices> getFaceVertexElementIndices(
+    const PXR_NS::TfToken& interpolation,
+    const size_t           numElements,
+    const size_t           numPoints,
+    const BifrostIndices&  faceVertices,
+    const BifrostIndices&  faceOffsets) {
+    const size_t numFaceVertices = faceVertices.size();
+    const size_t numFaces        = faceOffsets.size() - 1;
+
+    auto indices = Amino::newMutablePtr<BifrostIndices>(numFaceVertices);
+    if (interpolation == PXR_NS::UsdGeomTokens->faceVarying &&
+        numElements == numFaceVertices) {
+        for (size_t i = 0; i < numFaceVertices; ++i) {
+            (*indices)[i] = static_cast<Bifrost::Geometry::Index>(i);
+        }
+    } else if ((interpolation == PXR_NS::UsdGeomTokens->vertex ||
+                interpolation == PXR_NS::UsdGeomTokens->varying) &&
+               numElements == numPoints) {
+        for (size_t i = 0; i < numFaceVertices; ++i) {
+            (*indices)[i] = faceVertices[i];
+        }
+    } else if (interpolation == PXR_NS::UsdGeomTokens->uniform &&
+               numElements == numFaces) {
+        for (size_t f = 0; f < numFaces; ++f) {
+            for (auto i = faceOffsets[f]; i < faceOffsets[f + 1]; ++i) {
+                (*indices)[i] = static_cast<Bifrost::Geometry::Index>(f);
+            }
+        }
+    } else if (interpolation == PXR_NS::UsdGeomTokens->constant &&
+               numElements > 0) {
+        for (size_t i = 0; i < numFaceVertices; ++i) {
+            (*indices)[i] = 0;
+        }
+    } else {
+        return {};
+    }
+    return indices;
+}
+
+/// Returns the display color of each point of a mesh, mapped from the
+/// displayColor primvar according to its interpolation. Uniform and face
+/// varying colors are mapped through the faces and the face vertices, a point
+/// shared by faces of different colors getting the color of its last face
+/// vertex. Returns a null pointer if there are no colors, or if their number
+/// does not match their interpolation.
+Amino::Ptr<Amino::Array<Bifrost::Math::float3>> getMeshPointColors(
+    const PXR_NS::UsdGeomPrimvar& primvar,
+    const PXR_NS::UsdTimeCode     time,
+    const size_t                  numPoints,
+    const BifrostIndices&         faceVertices,
+    const BifrostIndices&         faceOffsets) {
+    PXR_NS::VtVec3fArray usdColors;
+    if (!primvar || !primvar.ComputeFlattened(&usdColors, time) ||
+        usdColors.empty()) {
+        return {};
+    }
+
+    const auto interpolation = primvar.GetInterpolation();
+    auto       colors =
+        Amino::newMutablePtr<Amino::Array<Bifrost::Math::float3>>(numPoints);
+    auto setColor = [&colors](size_t point, const PXR_NS::GfVec3f& c) {
+        (*colors)[point] = Bifrost::Math::float3{c[0], c[1], c[2]};
+    };
+
+    if (interpolation == PXR_NS::UsdGeomTokens->constant) {
+        for (size_t i = 0; i < numPoints; ++i) {
+            setColor(i, usdColors[0]);
+        }
+    } else if ((interpolation == PXR_NS::UsdGeomTokens->vertex ||
+                interpolation == PXR_NS::UsdGeomTokens->varying) &&
+               usdColors.size() == numPoints) {
+        for (size_t i = 0; i < numPoints; ++i) {
+            setColor(i, usdColors[i]);
+        }
+    } else if (interpolation == PXR_NS::UsdGeomTokens->uniform ||
+               interpolation == PXR_NS::UsdGeomTokens->faceVarying) {
+        auto colorIndices = getFaceVertexElementIndices(
+            interpolation, usdColors.size(), numPoints, faceVertices,
+            faceOffsets);
+        if (!colorIndices) {
+            return {};
+        }
+        // The points that are not used by any face keep the default color.
+        for (size_t i = 0; i < numPoints; ++i) {
+            (*colors)[i] = Bifrost::Math::float3{1.0f, 0.0f, 0.0f};
+        }
+        for (size_t i = 0; i < faceVertices.size(); ++i) {
+            setColor(faceVertices[i], usdColors[(*colorIndices)[i]]);
+        }
+    } else {
+        return {};
+    }
+    return colors.toImmutable();
+}
+
+/// Adds a data geo property to the given geometry.
+template <typename T>
+void setDataGeoProp(Bifrost::Object&             geometry,
+                    const Amino::String&         name,
+                    const Amino::String&         target,
+                    const T&                     defaultValue,
+                    Amino::Ptr<Amino::Array<T>>  data) {
+    auto property = Bifrost::createObject();
+    Bifrost::Geometry::populateDataGeoProp<T>(defaultValue, *property);
+    property->setProperty(Bifrost::Geometry::sTarget, target);
+    geometry.setProperty(name, std::move(property));
+    Bifrost::Geometry::setDataGeoPropValues(name, std::move(data), geometry);
+}
+
+/// Adds an indexed face vertex geo property to the given mesh. The index
+/// property maps each face vertex to an element of the data property.
+template <typename T>
+void setIndexedFaceVertexGeoProp(Bifrost::Object&                 mesh,
+                                 const Amino::String&             name,
+                                 const Amino::String&             indexName,
+                                 const T&                         defaultValue,
+                                 Amino::Ptr<Amino::Array<T>>      data,
+                                 Amino::Ptr<BifrostIndices>       indices) {
+    auto indexProperty = Bifrost::createObject();
+    indexProperty->setProperty("indices", std::move(indices));
+    indexProperty->setProperty(Bifrost::Geometry::sTarget, kFaceVertexComp);
+    indexProperty->setProperty("is_collection", false);
+    indexProperty->setProperty(
+        "depends_on", Amino::newClassPtr<Amino::Array<Amino::String>>());
+    mesh.setProperty(indexName, std::move(indexProperty));
+
+    setDataGeoProp(mesh, name, indexName, defaultValue, std::move(data));
+}
+
+/// Computes area weighted point normals, used when the USD mesh has no
+/// authored normals.
+Amino::Ptr<Amino::Array<Bifrost::Math::float3>> computePointNormals(
+    const Amino::Array<Bifrost::Math::float3>& positions,
+    const BifrostIndices&                      faceVertices,
+    const BifrostIndices&                      faceOffsets) {
+    std::vector<PXR_NS::GfVec3f> sums(positions.size(),
+                                      PXR_NS::GfVec3f(0.0f));
+    for (size_t f = 0; f + 1 < faceOffsets.size(); ++f) {
+        const auto begin = faceOffsets[f];
+        const auto end   = faceOffsets[f + 1];
+        // Newell's method: the length of the normal is twice the face area.
+        PXR_NS::GfVec3f normal(0.0f);
+        for (auto i = begin; i < end; ++i) {
+            const auto& p = positions[faceVertices[i]];
+            const auto& q =
+                positions[faceVertices[i + 1 < end ? i + 1 : begin]];
+            normal[0] += (p.y - q.y) * (p.z + q.z);
+            normal[1] += (p.z - q.z) * (p.x + q.x);
+            normal[2] += (p.x - q.x) * (p.y + q.y);
+        }
+        for (auto i = begin; i < end; ++i) {
+            sums[faceVertices[i]] += normal;
+        }
+    }
+
+    auto normals =
+        Amino::newMutablePtr<Amino::Array<Bifrost::Math::float3>>(sums.size());
+    for (size_t i = 0; i < sums.size(); ++i) {
+        auto& n = sums[i];
+        if (n.Normalize() == 0.0f) {
+            n = PXR_NS::GfVec3f(0.0f, 1.0f, 0.0f);
+        }
+        (*normals)[i] = Bifrost::Math::float3{n[0], n[1], n[2]};
+    }
+    return normals.toImmutable();
+}
+
+/// Reads a USD mesh into a new Bifrost mesh, with its points and normals
+/// transformed by the given matrix. Returns a null pointer if the mesh
+/// topology is invalid.
+Amino::Ptr<Bifrost::Object> readMesh(const PXR_NS::UsdGeomMesh&  usdMesh,
+                                     const PXR_NS::GfMatrix4d&   xform,
+                                     const PXR_NS::UsdTimeCode   time,
+                                     const bool                  readColor,
+                                     const PXR_NS::TfToken&      uvName) {
+    PXR_NS::VtVec3fArray usdPoints;
+    PXR_NS::VtIntArray   usdCounts;
+    PXR_NS::VtIntArray   usdIndices;
+    if (!usdMesh.GetPointsAttr().Get(&usdPoints, time) ||
+        !usdMesh.GetFaceVertexCountsAttr().Get(&usdCounts, time) ||
+        !usdMesh.GetFaceVertexIndicesAttr().Get(&usdIndices, time)) {
+        return {};
+    }
+    const size_t numPoints = usdPoints.size();
+
+    // Topology, validated to not produce an invalid Bifrost mesh:
+    auto faceOffsets = Amino::newMutablePtr<BifrostIndices>(usdCounts.size() + 1);
+    (*faceOffsets)[0] = 0;
+    size_t offset     = 0;
+    for (size_t i = 0; i < usdCounts.size(); ++i) {
+        if (usdCounts[i] < 0) {
+            return {};
+        }
+        offset += static_cast<size_t>(usdCounts[i]);
+        (*faceOffsets)[i + 1] = static_cast<Bifrost::Geometry::Index>(offset);
+    }
+    if (offset != usdIndices.size()) {
+        return {};
+    }
+
+    auto faceVertices = Amino::newMutablePtr<BifrostIndices>(usdIndices.size());
+    for (size_t i = 0; i < usdIndices.size(); ++i) {
+        if (usdIndices[i] < 0 ||
+            static_cast<size_t>(usdIndices[i]) >= numPoints) {
+            return {};
+        }
+        (*faceVertices)[i] =
+            static_cast<Bifrost::Geometry::Index>(usdIndices[i]);
+    }
+
+    const bool isIdentity = xform == PXR_NS::GfMatrix4d(1.0);
+    auto       positions =
+        Amino::newMutablePtr<Amino::Array<Bifrost::Math::float3>>(numPoints);
+    for (size_t i = 0; i < numPoints; ++i) {
+        const PXR_NS::GfVec3f p =
+            isIdentity ? usdPoints[i] : xform.Transform(usdPoints[i]);
+        (*positions)[i] = Bifrost::Math::float3{p[0], p[1], p[2]};
+    }
+
+    Amino::Ptr<Amino::Array<Bifrost::Math::float3>> positionsPtr =
+        positions.toImmutable();
+    Amino::Ptr<BifrostIndices> faceVerticesPtr = faceVertices.toImmutable();
+    Amino::Ptr<BifrostIndices> faceOffsetsPtr  = faceOffsets.toImmutable();
+
+    auto mesh = Bifrost::createObject();
+    Bifrost::Geometry::populateMesh(positionsPtr, faceVerticesPtr,
+                                    faceOffsetsPtr, *mesh);
+    mesh->setProperty(kPrimPathProp,
+                      Amino::String(usdMesh.GetPath().GetText()));
+
+    // Normals. As for UsdGeomPointBased, the primvars:normals primvar, when
+    // authored, takes precedence over the normals attribute. Indexed normals
+    // are flattened.
+    PXR_NS::VtVec3fArray usdNormals;
+    Amino::MutablePtr<BifrostIndices> normalIndices;
+    const auto normalsPrimvar =
+        PXR_NS::UsdGeomPrimvarsAPI(usdMesh.GetPrim())
+            .GetPrimvar(PXR_NS::UsdGeomTokens->primvarsNormals);
+    if (normalsPrimvar && normalsPrimvar.HasAuthoredValue()) {
+        if (normalsPrimvar.ComputeFlattened(&usdNormals, time)) {
+            normalIndices = getFaceVertexElementIndices(
+                normalsPrimvar.GetInterpolation(), usdNormals.size(),
+                numPoints, *faceVerticesPtr, *faceOffsetsPtr);
+        }
+    } else if (usdMesh.GetNormalsAttr().Get(&usdNormals, time)) {
+        normalIndices = getFaceVertexElementIndices(
+            usdMesh.GetNormalsInterpolation(), usdNormals.size(), numPoints,
+            *faceVerticesPtr, *faceOffsetsPtr);
+    }
+    if (normalIndices) {
+        const auto normalXform = xform.GetInverse().GetTranspose();
+        auto       normals = Amino::newMutablePtr<Amino::Array<Bifrost::Math::float3>>(
+            usdNormals.size());
+        for (size_t i = 0; i < usdNormals.size(); ++i) {
+            PXR_NS::GfVec3f n = usdNormals[i];
+            if (!isIdentity) {
+                n = normalXform.TransformDir(n);
+                n.Normalize();
+            }
+            (*normals)[i] = Bifrost::Math::float3{n[0], n[1], n[2]};
+        }
+        setIndexedFaceVertexGeoProp(
+            *mesh, kFaceVertexNormal, kFaceVertexNormalIndex,
+            Bifrost::Math::float3{0.0f, 1.0f, 0.0f}, normals.toImmutable(),
+            normalIndices.toImmutable());
+    } else {
+        setDataGeoProp(*mesh, kPointNormal, Bifrost::Geometry::sPointComp,
+                       Bifrost::Math::float3{0.0f, 1.0f, 0.0f},
+                       computePointNormals(*positionsPtr, *faceVerticesPtr,
+                                           *faceOffsetsPtr));
+    }
+
+    // UVs
+    auto uvPrimvar = uvName.IsEmpty()
+                         ? PXR_NS::UsdGeomPrimvar()
+                         : PXR_NS::UsdGeomPrimvarsAPI(usdMesh.GetPrim())
+                               .GetPrimvar(uvName);
+    PXR_NS::VtVec2fArray usdUVs;
+    if (uvPrimvar && uvPrimvar.Get(&usdUVs, time) && !usdUVs.empty()) {
+        PXR_NS::VtIntArray usdUVIndices;
+        const bool isIndexed = uvPrimvar.GetIndices(&usdUVIndices, time);
+        auto       uvIndices = getFaceVertexElementIndices(
+            uvPrimvar.GetInterpolation(),
+            isIndexed ? usdUVIndices.size() : usdUVs.size(), numPoints,
+            *faceVerticesPtr, *faceOffsetsPtr);
+        bool validIndices = static_cast<bool>(uvIndices);
+        if (validIndices && isIndexed) {
+            for (size_t i = 0; i < uvIndices->size() && validIndices; ++i) {
+                const int uvIndex = usdUVIndices[(*uvIndices)[i]];
+                validIndices      = uvIndex >= 0 &&
+                               static_cast<size_t>(uvIndex) < usdUVs.size();
+                (*uvIndices)[i] = static_cast<Bifrost::Geometry::Index>(uvIndex);
+            }
+        }
+        if (validIndices) {
+            auto uvs = Amino::newMutablePtr<Amino::Array<Bifrost::Math::float2>>(
+                usdUVs.size());
+            for (size_t i = 0; i < usdUVs.size(); ++i) {
+                (*uvs)[i] = Bifrost::Math::float2{usdUVs[i][0], usdUVs[i][1]};
+            }
+            setIndexedFaceVertexGeoProp(
+                *mesh, kFaceVertexUV, kFaceVertexUVIndex,
+                Bifrost::Math::float2{0.0f, 0.0f}, uvs.toImmutable(),
+                uvIndices.toImmutable());
+        }
+    }
+
+    // Display color, one color per point.
+    if (readColor) {
+        auto colors = getMeshPointColors(usdMesh.GetDisplayColorPrimvar(), time,
+                                         numPoints, *faceVerticesPtr,
+                                         *faceOffsetsPtr);
+        if (colors) {
+            setDataGeoProp(*mesh, kPointColor, Bifrost::Geometry::sPointComp,
+                           Bifrost::Math::float3{1.0f, 0.0f, 0.0f},
+                           std::move(colors));
+        }
+    }
+
+    return mesh.toImmutable();
+}
+
+/// Returns the offsets of the varying values of each curve, in the same form
+/// as the strand offsets. Linear curves have one varying value per vertex and
+/// cubic curves one per segment end. Returns a null pointer for the curves
+/// whose number of segments is not known, e.g. NURBS curves, or if a cubic
+/// curve has too few vertices.
+Amino::Ptr<BifrostIndices> computeCurveVaryingOffsets(
+    const PXR_NS::UsdGeomCurves& usdCurves,
+    const PXR_NS::VtIntArray&    usdCounts,
+    const PXR_NS::UsdTimeCode    time) {
+    PXR_NS::UsdGeomBasisCurves basisCurves(usdCurves.GetPrim());
+    if (!basisCurves) return {};
+
+    PXR_NS::TfToken type, basis, wrap;
+    basisCurves.GetTypeAttr().Get(&type, time);
+    basisCurves.GetBasisAttr().Get(&basis, time);
+    basisCurves.GetWrapAttr().Get(&wrap, time);
+    const bool isCubic    = type == PXR_NS::UsdGeomTokens->cubic;
+    const bool isPeriodic = wrap == PXR_NS::UsdGeomTokens->periodic;
+    const int  step       = basis == PXR_NS::UsdGeomTokens->bezier ? 3 : 1;
+
+    auto offsets = Amino::newMutablePtr<BifrostIndices>(usdCounts.size() + 1);
+    (*offsets)[0] = 0;
+    for (size_t c = 0; c < usdCounts.size(); ++c) {
+        int numVarying = usdCounts[c];
+        if (isCubic) {
+            if (isPeriodic) {
+                numVarying = usdCounts[c] / step;
+            } else if (usdCounts[c] >= 4) {
+                numVarying = (usdCounts[c] - 4) / step + 2;
+            } else {
+                return {};
+            }
+        }
+        (*offsets)[c + 1] =
+            (*offsets)[c] + static_cast<Bifrost::Geometry::Index>(numVarying);
+    }
+    return offsets.toImmutable();
+}
+
+/// Expands the values of a curves primvar to one value per point, according
+/// to the primvar interpolation. Varying values are linearly resampled along
+/// each curve. Returns false, leaving the points unset, if the number of values
+/// does not match the interpolation.
+template <typename T, typename U, typename ConvertFn>
+bool expandCurvesPrimvar(const PXR_NS::VtArray<T>& values,
+                         const PXR_NS::TfToken&    interpolation,
+                         const BifrostIndices&     strandOffsets,
+                         const BifrostIndices*     varyingOffsets,
+                         ConvertFn&&               convert,
+                         Amino::Array<U>&          points) {
+    const size_t numCurves = strandOffsets.size() - 1;
+    const size_t numPoints = points.size();
+    if (values.empty()) return false;
+
+    if (interpolation == PXR_NS::UsdGeomTokens->constant) {
+        for (size_t i = 0; i < numPoints; ++i) {
+            points[i] = convert(values[0]);
+        }
+    } else if (interpolation == PXR_NS::UsdGeomTokens->uniform &&
+               values.size() == numCurves) {
+        for (size_t c = 0; c < numCurves; ++c) {
+            for (auto i = strandOffsets[c]; i < strandOffsets[c + 1]; ++i) {
+                points[i] = convert(values[c]);
+            }
+        }
+    } else if (interpolation == PXR_NS::UsdGeomTokens->vertex &&
+               values.size() == numPoints) {
+        for (size_t i = 0; i < numPoints; ++i) {
+            points[i] = convert(values[i]);
+        }
+    } else if ((interpolation == PXR_NS::UsdGeomTokens->varying ||
+                interpolation == PXR_NS::UsdGeomTokens->faceVarying) &&
+               varyingOffsets &&
+               values.size() == (*varyingOffsets)[numCurves]) {
+        for (size_t c = 0; c < numCurves; ++c) {
+            const auto   first      = strandOffsets[c];
+            const size_t numVertex  = strandOffsets[c + 1] - first;
+            const auto   firstValue = (*varyingOffsets)[c];
+            const size_t numVarying = (*varyingOffsets)[c + 1] - firstValue;
+            if (numVarying == 0 && numVertex > 0) {
+                return false;
+            }
+            for (size_t i = 0; i < numVertex; ++i) {
+                const float t = numVertex > 1
+                                    ? static_cast<float>(i * (numVarying - 1)) /
+                                          static_cast<float>(numVertex - 1)
+                                    : 0.0f;
+                const size_t lo =
+                    std::min(static_cast<size_t>(t), numVarying - 1);
+                const size_t hi = std::min(lo + 1, numVarying - 1);
+                const float  w  = t - static_cast<float>(lo);
+                points[first + i] =
+                    convert(T(values[firstValue + lo] * (1.0f - w) +
+                              values[firstValue + hi] * w));
+            }
+        }
+    } else {
+        return false;
+    }
+    return true;
+}
+
+/// Logs that a curves primvar could not be read.
+void logSkippedCurvesPrimvar(const PXR_NS::UsdGeomCurves& usdCurves,
+                             const char*                  primvarName,
+                             const size_t                 numValues,
+                             const PXR_NS::TfToken&       interpolation) {
+    if (Logger::errorVerboseLevel() > 0) {
+        std::cerr << "get_usd_geom_curves: skipped the " << numValues << " "
+                  << interpolation.GetString() << " " << primvarName << " of "
+                  << usdCurves.GetPath().GetString() << std::endl;
+    }
+}
+
+/// Reads USD curves into a new Bifrost strands object, with its points
+/// transformed by the given matrix. The curve widths are read into the
+/// "point_size" property. Returns a null pointer if the curve vertex counts do
+/// not match the number of points.
+Amino::Ptr<Bifrost::Object> readCurves(const PXR_NS::UsdGeomCurves& usdCurves,
+                                       const PXR_NS::GfMatrix4d&    xform,
+                                       const PXR_NS::UsdTimeCode    time,
+                                       const bool                   readColor) {
+    PXR_NS::VtVec3fArray usdPoints;
+    PXR_NS::VtIntArray   usdCounts;
+    if (!usdCurves.GetPointsAttr().Get(&usdPoints, time) ||
+        !usdCurves.GetCurveVertexCountsAttr().Get(&usdCounts, time)) {
+        return {};
+    }
+    const size_t numPoints = usdPoints.size();
+    const size_t numCurves = usdCounts.size();
+    if (std::any_of(usdCounts.cbegin(), usdCounts.cend(),
+                    [](int count) { return count < 0; })) {
+        return {};
+    }
+
+    // The strand offsets are the inclusive prefix sum of the vertex counts,
+    // preceded by a zero.
+    auto strandOffsets = Amino::newMutablePtr<BifrostIndices>(numCurves + 1);
+    (*strandOffsets)[0] = 0;
+    if (numCurves > 0) {
+        std::inclusive_scan(usdCounts.cbegin(), usdCounts.cend(),
+                            &(*strandOffsets)[1], std::plus<>{},
+                            Bifrost::Geometry::Index{0});
+    }
+    if ((*strandOffsets)[numCurves] != numPoints) {
+        return {};
+    }
+
+    const bool isIdentity = xform == PXR_NS::GfMatrix4d(1.0);
+    auto       positions =
+        Amino::newMutablePtr<Amino::Array<Bifrost::Math::float3>>(numPoints);
+    for (size_t i = 0; i < numPoints; ++i) {
+        const PXR_NS::GfVec3f p =
+            isIdentity ? usdPoints[i] : xform.Transform(usdPoints[i]);
+        (*positions)[i] = Bifrost::Math::float3{p[0], p[1], p[2]};
+    }
+
+    Amino::Ptr<BifrostIndices> strandOffsetsPtr = strandOffsets.toImmutable();
+
+    auto strands = Bifrost::createObject();
+    Bifrost::Geometry::populateStrands(positions.toImmutable(),
+                                       strandOffsetsPtr, *strands);
+    strands->setProperty(kPrimPathProp,
+                         Amino::String(usdCurves.GetPath().GetText()));
+
+    // Widths and display color, one per point. They are expanded to the points
+    // according to their interpolation.
+    Amino::Ptr<BifrostIndices> varyingOffsets =
+        computeCurveVaryingOffsets(usdCurves, usdCounts, time);
+
+    PXR_NS::VtFloatArray usdWidths;
+    if (usdCurves.GetWidthsAttr().Get(&usdWidths, time) &&
+        !usdWidths.empty()) {
+        const auto interpolation = usdCurves.GetWidthsInterpolation();
+        auto       widths =
+            Amino::newMutablePtr<Amino::Array<Amino::float_t>>(numPoints);
+        if (expandCurvesPrimvar(
+                usdWidths, interpolation, *strandOffsetsPtr,
+                varyingOffsets.get(), [](float w) { return w; }, *widths)) {
+            setDataGeoProp(*strands, kPointSize, Bifrost::Geometry::sPointComp,
+                           Amino::float_t{1.0f}, widths.toImmutable());
+        } else {
+            logSkippedCurvesPrimvar(usdCurves, "widths", usdWidths.size(),
+                                    interpolation);
+        }
+    }
+
+    PXR_NS::VtVec3fArray usdColors;
+    const auto           colorPrimvar = usdCurves.GetDisplayColorPrimvar();
+    if (readColor && colorPrimvar &&
+        colorPrimvar.ComputeFlattened(&usdColors, time) &&
+        !usdColors.empty()) {
+        const auto interpolation = colorPrimvar.GetInterpolation();
+        auto       colors =
+            Amino::newMutablePtr<Amino::Array<Bifrost::Math::float3>>(numPoints);
+        if (expandCurvesPrimvar(
+                usdColors, interpolation, *strandOffsetsPtr,
+                varyingOffsets.get(),
+                [](const PXR_NS::GfVec3f& c) {
+                    return Bifrost::Math::float3{c[0], c[1], c[2]};
+                },
+                *colors)) {
+            setDataGeoProp(*strands, kPointColor,
+                           Bifrost::Geometry::sPointComp,
+                           Bifrost::Math::float3{1.0f, 0.0f, 0.0f},
+                           colors.toImmutable());
+        } else {
+            logSkippedCurvesPrimvar(usdCurves, "display colors",
+                                    usdColors.size(), interpolation);
+        }
+    }
+
+    return strands.toImmutable();
+}
+
+/// Reads all the prims of the given schema type found under a prim into
+/// Bifrost geometries, in parallel, using the given read function. The
+/// geometries that could not be read are skipped. Returns false if the prim
+/// is not found.
+template <typename Schema, typename ReadFn>
+bool readGeometries(
+    const char*                        nodeName,
+    const BifrostUsd::Stage&           stage,
+    const Amino::String&               prim_path,
+    const Amino::Array<Amino::String>& exclude_prefixes,
+    const float                        frame,
+    ReadFn&&                           readFn,
+    Amino::MutablePtr<Amino::Array<Amino::Ptr<Bifrost::Object>>>& geometries) {
+    geometries =
+        Amino::newMutablePtr<Amino::Array<Amino::Ptr<Bifrost::Object>>>();
+    if (!stage) return false;
+
+    try {
+        auto root = USDUtils::get_prim_at_path(
+            prim_path.empty() ? "/" : prim_path, stage);
+        if (!root) return false;
+
+        const auto time   = PXR_NS::UsdTimeCode(static_cast<double>(frame));
+        const auto prims  = collectPrims<Schema>(root, exclude_prefixes);
+        const auto xforms = computeLocalToWorldTransforms(prims, time);
+
+        // Each geometry is read by a single task, directly into its slot of
+        // the output array.
+        geometries->resize(prims.size());
+        PXR_NS::WorkParallelForN(
+            prims.size(), [&](size_t begin, size_t end) {
+                for (size_t i = begin; i < end; ++i) {
+                    try {
+                        (*geometries)[i] = readFn(prims[i], xforms[i], time);
+                    } catch (std::exception& e) {
+                        log_exception(nodeName, e);
+                    }
+                }
+            });
+
+        // Remove the geometries that could not be read, preserving the order:
+        size_t numGeometries = 0;
+        for (size_t i = 0; i < geometries->size(); ++i) {
+            if ((*geometries)[i]) {
+                (*geometries)[numGeometries++] = std::move((*geometries)[i]);
+            }
+        }
+        geometries->resize(numGeometries);
+    } catch (std::exception& e) {
+        log_exception(nodeName, e);
+        return false;
+    }
+    return true;
+}
+
+} // namespace
+
 bool USD::Prim::get_usd_geom_xform_vectors(
     const BifrostUsd::Prim&      prim,
     const float                    frame,
@@ -568,3 +1235,39 @@ bool USD::Prim::get_usd_geom_points(
     }
     return success;
 }
+
+bool USD::Prim::get_usd_geom_meshes(
+    const BifrostUsd::Stage&           stage,
+    const Amino::String&               prim_path,
+    const Amino::Array<Amino::String>& exclude_prefixes,
+    const bool                         use_display_color,
+    const Amino::String&               uv_name,
+    const float                        frame,
+    Amino::MutablePtr<Amino::Array<Amino::Ptr<Bifrost::Object>>>& meshes) {
+    const PXR_NS::TfToken uvName(uv_name.c_str());
+    return readGeometries<PXR_NS::UsdGeomMesh>(
+        "get_usd_geom_meshes", stage, prim_path, exclude_prefixes, frame,
+        [&](const PXR_NS::UsdPrim& prim, const PXR_NS::GfMatrix4d& xform,
+            const PXR_NS::UsdTimeCode time) {
+            return readMesh(PXR_NS::UsdGeomMesh(prim), xform, time,
+                            use_display_color, uvName);
+        },
+        meshes);
+}
+
+bool USD::Prim::get_usd_geom_curves(
+    const BifrostUsd::Stage&           stage,
+    const Amino::String&               prim_path,
+    const Amino::Array<Amino::String>& exclude_prefixes,
+    const bool                         use_display_color,
+    const float                        frame,
+    Amino::MutablePtr<Amino::Array<Amino::Ptr<Bifrost::Object>>>& strands) {
+    return readGeometries<PXR_NS::UsdGeomCurves>(
+        "get_usd_geom_curves", stage, prim_path, exclude_prefixes, frame,
+        [&](const PXR_NS::UsdPrim& prim, const PXR_NS::GfMatrix4d& xform,
+            const PXR_NS::UsdTimeCode time) {
+            return readCurves(PXR_NS::UsdGeomCurves(prim), xform, time,
+                              use_display_color);
+        },
+        strands);
+}
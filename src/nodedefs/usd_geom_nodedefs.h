@@ -22,6 +22,7 @@
 #include <Amino/Core/Array.h>
 #include <Amino/Core/Ptr.h>
 #include <Bifrost/Math/Types.h>
+#include <Bifrost/Object/Object.h>
 #include <BifrostUsd/Prim.h>
 #include <BifrostUsd/Stage.h>
 
@@ -283,6 +284,85 @@ bool get_usd_geom_points(
                        "usd.svg",
                        "outName=success");
 
+/// \ingroup Prim
+/// \defgroup get_usd_geom_meshes get_usd_geom_meshes node
+///
+/// \brief This node reads all the USD meshes found under a prim, and outputs
+/// them as Bifrost meshes.
+///
+/// The meshes are read in parallel. The points and normals are returned in
+/// world space. Each mesh gets a "prim_path" property holding the path of the
+/// USD prim it was read from.
+///
+/// \param [in] stage The stage from which to read the meshes.
+/// \param [in] prim_path The path of the prim under which to look for meshes.
+///             The prim itself is read if it is a mesh. If empty, the whole
+///             stage is read.
+/// \param [in] exclude_prefixes The meshes whose path starts with one of these
+///             prefixes are skipped.
+/// \param [in] use_display_color Reads the displayColor primvar into the
+///             "point_color" property of the meshes.
+/// \param [in] uv_name The name of the primvar holding the UVs, without the
+///             "primvars:" namespace.
+/// \param [in] frame The frame at which to read the meshes.
+/// \param [out] meshes The Bifrost meshes, in traversal order. The USD meshes
+///             with invalid topology are skipped.
+/// \returns true if the prim was found.
+USD_NODEDEF_DECL
+bool get_usd_geom_meshes(
+    const BifrostUsd::Stage&           stage,
+    const Amino::String&               prim_path,
+    const Amino::Array<Amino::String>& exclude_prefixes,
+    const bool                         use_display_color,
+    const Amino::String&               uv_name,
+    const float                        frame
+        AMINO_ANNOTATE("Amino::Port value=0 metadata=[{quick_create, "
+                      "string, Core::Time::time.frame}] "),
+    Amino::MutablePtr<Amino::Array<Amino::Ptr<Bifrost::Object>>>& meshes)
+    USDNODE_DOC_ICON_X("get_usd_geom_meshes",
+                       "get_usd_geom_meshes",
+                       "usd.svg",
+                       "outName=success");
+
+/// \ingroup Prim
+/// \defgroup get_usd_geom_curves get_usd_geom_curves node
+///
+/// \brief This node reads all the USD curves found under a prim, and outputs
+/// them as Bifrost strands.
+///
+/// The curves are read in parallel. The points are returned in world space
+/// and the curve widths are read into the "point_size" property. Each strands
+/// object gets a "prim_path" property holding the path of the USD prim it was
+/// read from.
+///
+/// \param [in] stage The stage from which to read the curves.
+/// \param [in] prim_path The path of the prim under which to look for curves.
+///             The prim itself is read if it is a curves prim. If empty, the
+///             whole stage is read.
+/// \param [in] exclude_prefixes The curves whose path starts with one of
+///             these prefixes are skipped.
+/// \param [in] use_display_color Reads the displayColor primvar into the
+///             "point_color" property of the strands.
+/// \param [in] frame The frame at which to read the curves.
+/// \param [out] strands The Bifrost strands, in traversal order. The USD
+///             curves whose vertex counts do not match their points are
+///             skipped.
+/// \returns true if the prim was found.
+USD_NODEDEF_DECL
+bool get_usd_geom_curves(
+    const BifrostUsd::Stage&           stage,
+    const Amino::String&               prim_path,
+    const Amino::Array<Amino::String>& exclude_prefixes,
+    const bool                         use_display_color,
+    const float                        frame
+        AMINO_ANNOTATE("Amino::Port value=0 metadata=[{quick_create, "
+                      "string, Core::Time::time.frame}] "),
+    Amino::MutablePtr<Amino::Array<Amino::Ptr<Bifrost::Object>>>& strands)
+    USDNODE_DOC_ICON_X("get_usd_geom_curves",
+                       "get_usd_geom_curves",
+                       "usd.svg",
+                       "outName=success");
+
 } // namespace Prim
 } // namespace USD
 
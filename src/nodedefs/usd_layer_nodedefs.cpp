@@ -222,6 +222,40 @@ void USD::Layer::export_layer_to_string(const BifrostUsd::Layer&    layer,
     }
 }
 
+void USD::Layer::export_layer_to_string_chunks(
+    const BifrostUsd::Layer&                         layer,
+    const bool                                       export_sub_layers,
+    Amino::MutablePtr<Amino::Array<Amino::String>>& chunks) {
+    chunks = Amino::newMutablePtr<Amino::Array<Amino::String>>();
+    try {
+        if (layer) {
+            layer.exportToChunks(
+                [&chunks](const std::string& chunk) {
+                    chunks->push_back(chunk.c_str());
+                    return true;
+                },
+                export_sub_layers);
+        }
+    } catch (std::exception& e) {
+        log_exception("export_layer_to_string_chunks", e);
+    }
+}
+
+void USD::Layer::get_layer_exported_size(
+    const BifrostUsd::Layer& layer,
+    const bool               export_sub_layers,
+    Amino::long_t&           size) {
+    size = 0;
+    try {
+        if (layer) {
+            size = static_cast<Amino::long_t>(
+                layer.exportedSize(export_sub_layers));
+        }
+    } catch (std::exception& e) {
+        log_exception("get_layer_exported_size", e);
+    }
+}
+
 bool USD::Layer::export_layer_to_file(const BifrostUsd::Layer&  layer,
                                       const Amino::String&      file,
                                       const bool                relative_path) {
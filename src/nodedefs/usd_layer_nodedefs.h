@@ -204,6 +204,46 @@ void export_layer_to_string(const BifrostUsd::Layer& layer,
                      "export_layer_to_string",
                      "usd.svg");
 
+/// \ingroup Layer
+/// \defgroup export_layer_to_string_chunks export_layer_to_string_chunks node
+///
+/// \brief This node exports a layer to strings, one for the layer metadata
+/// and one for each root prim. Large layers are exported without being
+/// copied, and without building a single string holding the whole text.
+/// All the chunks are returned at once though, so they take as much memory
+/// as the whole text. Use get_layer_exported_size to get the size of the
+/// text without holding it.
+///
+/// \param [in] layer The layer to export.
+/// \param [in] export_sub_layers Exports any sublayers.
+/// \param [out] chunks The layer in text format, by chunks. Joined together,
+///             they are the result of export_layer_to_string.
+USD_NODEDEF_DECL
+void export_layer_to_string_chunks(
+    const BifrostUsd::Layer&                         layer,
+    const bool                                       export_sub_layers,
+    Amino::MutablePtr<Amino::Array<Amino::String>>& chunks)
+    USDNODE_DOC_ICON("export_layer_to_string_chunks",
+                     "export_layer_to_string_chunks",
+                     "usd.svg");
+
+/// \ingroup Layer
+/// \defgroup get_layer_exported_size get_layer_exported_size node
+///
+/// \brief This node returns the size of the text export_layer_to_string
+/// returns, without holding the whole text in memory.
+///
+/// \param [in] layer The layer to export.
+/// \param [in] export_sub_layers Exports any sublayers.
+/// \param [out] size The size, in bytes, of the layer in text format.
+USD_NODEDEF_DECL
+void get_layer_exported_size(const BifrostUsd::Layer& layer,
+                             const bool               export_sub_layers,
+                             Amino::long_t&           size)
+    USDNODE_DOC_ICON("get_layer_exported_size",
+                     "get_layer_exported_size",
+                     "usd.svg");
+
 /// \ingroup Layer
 /// \defgroup export_layer_to_file export_layer_to_file node
 ///
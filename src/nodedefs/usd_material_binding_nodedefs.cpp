@@ -44,8 +44,10 @@ bool USD::Shading::get_material_path(
     const bool                         compute_bound_material,
     Amino::String&                     path) {
 
+    // Don't apply the API schema: the prim's stage may be shared with other
+    // copies of the stage (see BifrostUsd::Stage::detach()).
     auto materialBindingAPI =
-        PXR_NS::UsdShadeMaterialBindingAPI::Apply(prim.getPxrPrim());
+        PXR_NS::UsdShadeMaterialBindingAPI(prim.getPxrPrim());
     if (materialBindingAPI) {
         auto materialPurpose = USDUtils::GetMaterialPurpose(material_purpose);
         auto materialPath    = PXR_NS::SdfPath{};
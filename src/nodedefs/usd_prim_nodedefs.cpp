@@ -17,13 +17,20 @@
 #include "usd_prim_nodedefs.h"
 
 #include <Amino/Core/String.h>
+#include <pxr/usd/sdf/attributeSpec.h>
+#include <pxr/usd/sdf/changeBlock.h>
 #include <pxr/usd/sdf/copyUtils.h>
+#include <pxr/usd/sdf/primSpec.h>
 #include <pxr/usd/usd/editContext.h>
 #include <pxr/usd/usd/inherits.h>
 #include <pxr/usd/usd/references.h>
 #include <pxr/usd/usd/specializes.h>
 
+#include <algorithm>
+#include <vector>
+
 #include "return_guard.h"
+#include "usd_attribute_nodedefs.h"
 #include "usd_type_converter.h"
 #include "usd_utils.h"
 
@@ -35,6 +42,7 @@ BIFUSD_WARNING_DISABLE_MSC(4003)
 #include <pxr/usd/usd/payloads.h>
 #include <pxr/usd/usdGeom/imageable.h>
 #include <pxr/usd/usdGeom/pointInstancer.h>
+#include <pxr/usd/usdGeom/tokens.h>
 #include <pxr/usd/usdGeom/xformCache.h>
 #include <pxr/usd/usdGeom/xformCommonAPI.h>
 #include <pxr/usd/usdVol/field3DAsset.h>
@@ -105,6 +113,197 @@ std::string get_part_after_anchor_path(const std::string& anchor_path,
     return resolved_identifier;
 }
 
+/// An attribute definition, as built by the define_usd_attribute compound,
+/// converted once to Pixar types so it can be authored on many prims.
+struct AttributeDefinition {
+    PXR_NS::TfToken          name;
+    PXR_NS::SdfValueTypeName typeName;
+    PXR_NS::VtValue          value;
+    /// The value of each prim, when an array of values is given for an
+    /// attribute that is not an array. Otherwise, all the prims get value.
+    std::vector<PXR_NS::VtValue> primValues;
+    PXR_NS::UsdTimeCode          time = PXR_NS::UsdTimeCode::Default();
+    PXR_NS::TfToken              interpolation;
+    bool                         custom = false;
+
+    /// Returns the value to author on the prim at the given index.
+    const PXR_NS::VtValue& getValue(size_t primIndex) const {
+        return primValues.empty() ? value : primValues[primIndex];
+    }
+};
+
+template <typename T>
+bool any_to_value(const Amino::Any& any, PXR_NS::VtValue& value) {
+    if (auto payload = Amino::any_cast<T>(&any)) {
+        value = PXR_NS::VtValue(toPxr(*payload));
+        return true;
+    }
+    if (auto payload = Amino::any_cast<Amino::Ptr<Amino::Array<T>>>(&any)) {
+        if (*payload) value = PXR_NS::VtValue(toPxr(**payload));
+        return true;
+    }
+    return false;
+}
+
+template <typename T>
+bool any_to_values(const Amino::Any& any, std::vector<PXR_NS::VtValue>& values) {
+    if (auto payload = Amino::any_cast<Amino::Ptr<Amino::Array<T>>>(&any)) {
+        if (*payload) {
+            values.reserve((*payload)->size());
+            for (const auto& element : **payload) {
+                values.emplace_back(toPxr(element));
+            }
+        }
+        return true;
+    }
+    return false;
+}
+
+PXR_NS::VtValue to_attribute_value(const PXR_NS::VtValue&          value,
+                                   const PXR_NS::SdfValueTypeName& type_name) {
+    // Strings are authored as asset paths or tokens when the attribute
+    // requires it, like set_prim_attribute does.
+    if (value.IsHolding<std::string>()) {
+        const auto& str = value.UncheckedGet<std::string>();
+        if (type_name == PXR_NS::SdfValueTypeNames->Asset) {
+            return PXR_NS::VtValue(PXR_NS::SdfAssetPath(str));
+        } else if (type_name == PXR_NS::SdfValueTypeNames->Token) {
+            return PXR_NS::VtValue(PXR_NS::TfToken(str));
+        }
+    } else if (value.IsHolding<PXR_NS::VtArray<std::string>>()) {
+        const auto& strs = value.UncheckedGet<PXR_NS::VtArray<std::string>>();
+        if (type_name == PXR_NS::SdfValueTypeNames->AssetArray) {
+            PXR_NS::VtArray<PXR_NS::SdfAssetPath> assets(strs.size());
+            for (size_t i = 0; i < strs.size(); ++i) {
+                assets[i] = PXR_NS::SdfAssetPath(strs[i]);
+            }
+            return PXR_NS::VtValue(assets);
+        } else if (type_name == PXR_NS::SdfValueTypeNames->TokenArray) {
+            PXR_NS::VtTokenArray tokens(strs.size());
+            for (size_t i = 0; i < strs.size(); ++i) {
+                tokens[i] = PXR_NS::TfToken(strs[i]);
+            }
+            return PXR_NS::VtValue(tokens);
+        }
+    }
+    // Sdf does not check the value type, so the value is cast to the
+    // attribute type (e.g. float3 to point3d) before authoring.
+    return PXR_NS::VtValue::CastToTypeid(value, type_name.GetType().GetTypeid());
+}
+
+PXR_NS::VtValue get_definition_value(const Amino::Any&               any,
+                                     const PXR_NS::SdfValueTypeName& type_name) {
+    PXR_NS::VtValue value;
+#define ANY_TO_VALUE(TYPE) any_to_value<TYPE>(any, value) ||
+    bool found = FOR_EACH_SUPPORTED_ARRAY_ATTRIBUTE(ANY_TO_VALUE) false;
+#undef ANY_TO_VALUE
+    if (!found || value.IsEmpty()) return PXR_NS::VtValue();
+    return to_attribute_value(value, type_name);
+}
+
+/// Returns true if the given value is an array of values for an attribute
+/// that is not an array, in which case the values are converted and returned,
+/// one per element. A value that cannot be converted is left empty.
+bool get_definition_prim_values(const Amino::Any&               any,
+                                const PXR_NS::SdfValueTypeName& type_name,
+                                std::vector<PXR_NS::VtValue>&   values) {
+    if (type_name.IsArray()) return false;
+#define ANY_TO_VALUES(TYPE) any_to_values<TYPE>(any, values) ||
+    bool found = FOR_EACH_SUPPORTED_ARRAY_ATTRIBUTE(ANY_TO_VALUES) false;
+#undef ANY_TO_VALUES
+    if (!found) return false;
+    for (auto& value : values) {
+        value = to_attribute_value(value, type_name);
+    }
+    return true;
+}
+
+bool get_attribute_definition(const Bifrost::Object& object,
+                              AttributeDefinition&   definition) {
+    auto name = object.getProperty("name");
+    auto type = object.getProperty("type");
+    auto namePayload = Amino::any_cast<Amino::String>(&name);
+    auto typePayload = Amino::any_cast<BifrostUsd::SdfValueTypeName>(&type);
+    if (!namePayload || namePayload->empty() || !typePayload) return false;
+
+    definition.name     = PXR_NS::TfToken(namePayload->c_str());
+    definition.typeName = GetSdfValueTypeName(*typePayload);
+    if (!definition.typeName) return false;
+
+    if (object.hasProperty("value")) {
+        const auto value = object.getProperty("value");
+        if (get_definition_prim_values(value, definition.typeName,
+                                       definition.primValues)) {
+            if (std::any_of(definition.primValues.cbegin(),
+                            definition.primValues.cend(),
+                            [](const auto& v) { return v.IsEmpty(); })) {
+                return false;
+            }
+        } else {
+            definition.value = get_definition_value(value, definition.typeName);
+            if (definition.value.IsEmpty()) return false;
+        }
+    }
+
+    auto custom = object.getProperty("custom");
+    if (auto payload = Amino::any_cast<Amino::bool_t>(&custom)) {
+        definition.custom = *payload;
+    }
+    auto useFrame = object.getProperty("use_frame");
+    auto frame    = object.getProperty("frame");
+    auto useFramePayload = Amino::any_cast<Amino::bool_t>(&useFrame);
+    auto framePayload    = Amino::any_cast<Amino::float_t>(&frame);
+    if (useFramePayload && *useFramePayload && framePayload) {
+        definition.time =
+            PXR_NS::UsdTimeCode(static_cast<double>(*framePayload));
+    }
+    auto interpolation = object.getProperty("interpolation");
+    if (auto payload =
+            Amino::any_cast<BifrostUsd::UsdGeomPrimvarInterpolation>(
+                &interpolation)) {
+        definition.interpolation = GetUsdGeomPrimvarInterpolation(*payload);
+    }
+    return true;
+}
+
+bool define_attribute_spec(const PXR_NS::SdfLayerHandle&    layer,
+                           const PXR_NS::SdfPrimSpecHandle& primSpec,
+                           const AttributeDefinition&       definition,
+                           const PXR_NS::VtValue&           value) {
+    const auto path = primSpec->GetPath().AppendProperty(definition.name);
+    auto       spec = layer->GetAttributeAtPath(path);
+    if (!spec) {
+        spec = PXR_NS::SdfAttributeSpec::New(
+            primSpec, definition.name, definition.typeName,
+            PXR_NS::SdfVariabilityVarying, definition.custom);
+        if (!spec) return false;
+    }
+    if (!definition.interpolation.IsEmpty()) {
+        spec->SetInfo(PXR_NS::UsdGeomTokens->interpolation,
+                      PXR_NS::VtValue(definition.interpolation));
+    }
+    if (value.IsEmpty()) return true;
+    if (definition.time.IsDefault()) {
+        return spec->SetDefaultValue(value);
+    }
+    layer->SetTimeSample(path, definition.time.GetValue(), value);
+    return true;
+}
+
+bool define_attribute(const PXR_NS::UsdPrim&     pxr_prim,
+                      const AttributeDefinition& definition,
+                      const PXR_NS::VtValue&     value) {
+    auto pxr_attribute = pxr_prim.CreateAttribute(
+        definition.name, definition.typeName, definition.custom);
+    if (!pxr_attribute) return false;
+    if (!definition.interpolation.IsEmpty()) {
+        pxr_attribute.SetMetadata(PXR_NS::UsdGeomTokens->interpolation,
+                                  definition.interpolation);
+    }
+    if (value.IsEmpty()) return true;
+    return pxr_attribute.Set(value, definition.time);
+}
+
 } // namespace
 
 bool USD::Prim::get_prim_at_path(Amino::Ptr<BifrostUsd::Stage>        stage,
@@ -305,6 +504,126 @@ void USD::Prim::override_prim(BifrostUsd::Stage& stage,
     }
 }
 
+bool USD::Prim::define_prims(
+    BifrostUsd::Stage&                                stage,
+    const Amino::Array<Amino::String>&                prim_paths,
+    const Amino::Array<Amino::String>&                types,
+    const Amino::Array<Amino::Ptr<Bifrost::Object>>& attribute_definitions) {
+    if (!stage) return false;
+    if (!types.empty() && types.size() != 1 &&
+        types.size() != prim_paths.size()) {
+        return false;
+    }
+
+    try {
+        VariantEditContext ctx(stage);
+
+        bool success = true;
+
+        std::vector<AttributeDefinition> attributes;
+        attributes.reserve(attribute_definitions.size());
+        for (const auto& object : attribute_definitions) {
+            AttributeDefinition definition;
+            if (object && get_attribute_definition(*object, definition) &&
+                (definition.primValues.empty() ||
+                 definition.primValues.size() == prim_paths.size())) {
+                attributes.push_back(std::move(definition));
+            } else {
+                success = false;
+            }
+        }
+
+        std::vector<PXR_NS::SdfPath> paths;
+        std::vector<PXR_NS::TfToken> typeNames;
+        std::vector<size_t>          primIndices;
+        paths.reserve(prim_paths.size());
+        typeNames.reserve(prim_paths.size());
+        primIndices.reserve(prim_paths.size());
+        for (size_t i = 0; i < prim_paths.size(); ++i) {
+            PXR_NS::SdfPath path(
+                USDUtils::resolve_prim_path(prim_paths[i], stage).c_str());
+            if (!path.IsPrimPath()) {
+                success = false;
+                continue;
+            }
+            paths.push_back(std::move(path));
+            primIndices.push_back(i);
+            typeNames.emplace_back(
+                types.empty() ? ""
+                              : types[types.size() == 1 ? 0 : i].c_str());
+        }
+        if (paths.empty()) return success;
+
+        const auto editTarget = stage->GetEditTarget();
+        if (editTarget.GetMapFunction().IsIdentity()) {
+            // Like UsdStage::DefinePrim, ancestors that are not defined yet
+            // are defined as typeless prims. They are found before authoring
+            // anything, since the stage is not recomposed within the
+            // SdfChangeBlock.
+            std::vector<PXR_NS::SdfPath>  ancestors;
+            PXR_NS::SdfPathSet            visited;
+            for (const auto& path : paths) {
+                for (auto parent = path.GetParentPath();
+                     parent != PXR_NS::SdfPath::AbsoluteRootPath() &&
+                     visited.insert(parent).second;
+                     parent = parent.GetParentPath()) {
+                    auto pxr_prim = stage->GetPrimAtPath(parent);
+                    if (!pxr_prim || !pxr_prim.IsDefined()) {
+                        ancestors.push_back(parent);
+                    }
+                }
+            }
+
+            // All the specs are written in the edit layer within a single
+            // change block, so that the stage is recomposed only once.
+            const auto             layer = editTarget.GetLayer();
+            PXR_NS::SdfChangeBlock changeBlock;
+            for (const auto& ancestor : ancestors) {
+                auto primSpec = PXR_NS::SdfCreatePrimInLayer(layer, ancestor);
+                if (!primSpec) {
+                    success = false;
+                    continue;
+                }
+                primSpec->SetSpecifier(PXR_NS::SdfSpecifierDef);
+            }
+            for (size_t i = 0; i < paths.size(); ++i) {
+                auto primSpec = PXR_NS::SdfCreatePrimInLayer(layer, paths[i]);
+                if (!primSpec) {
+                    success = false;
+                    continue;
+                }
+                primSpec->SetSpecifier(PXR_NS::SdfSpecifierDef);
+                if (!typeNames[i].IsEmpty()) {
+                    primSpec->SetTypeName(typeNames[i].GetString());
+                }
+                for (const auto& attribute : attributes) {
+                    success &= define_attribute_spec(
+                        layer, primSpec, attribute,
+                        attribute.getValue(primIndices[i]));
+                }
+            }
+        } else {
+            for (size_t i = 0; i < paths.size(); ++i) {
+                auto pxr_prim = stage->DefinePrim(paths[i], typeNames[i]);
+                if (!pxr_prim) {
+                    success = false;
+                    continue;
+                }
+                for (const auto& attribute : attributes) {
+                    success &= define_attribute(
+                        pxr_prim, attribute, attribute.getValue(primIndices[i]));
+                }
+            }
+        }
+        stage.last_modified_prim = paths.back().GetText();
+        return success;
+
+    } catch (std::exception& e) {
+        log_exception("define_prims", e);
+    }
+    return false;
+}
+
 bool USD::Prim::add_applied_schema(BifrostUsd::Stage&   stage,
                                    const Amino::String& prim_path,
                                    const Amino::String& applied_schema_name) {
@@ -184,6 +184,37 @@ void override_prim(BifrostUsd::Stage& stage USDPORT_INOUT("out_stage"),
                    const Amino::String&       path)
     USDNODE_DOC_ICON("override_prim", "override_prim", "usd.svg");
 
+/// \ingroup Prim
+/// \defgroup define_prims define_prims node
+///
+/// \brief Defines many prims, and their attributes, at once.
+///
+/// When the edit target does not remap paths (e.g. no variant is being
+/// edited), the prim and attribute specs are written directly in the edit
+/// layer, and the stage is recomposed only once for the whole batch. This is
+/// much faster than defining the prims one by one.
+///
+/// \param [in] stage The USD stage in which to define the prims.
+/// \param [in] prim_paths The paths to the USD prims.
+/// \param [in] types The types of the USD prims. Either empty, one type
+///             for all the prims, or one type per prim.
+/// \param [in] attribute_definitions The attribute definitions created by
+///             define_usd_attribute, defined on each prim. A definition
+///             whose value is an array while its type is not gives one value
+///             per prim, in the order of prim_paths, and is skipped if the
+///             sizes differ. Connections are not supported.
+/// \returns true if all the prims and attributes are defined.
+USD_NODEDEF_DECL
+bool define_prims(
+    BifrostUsd::Stage& stage USDPORT_INOUT("out_stage"),
+    const Amino::Array<Amino::String>&                prim_paths,
+    const Amino::Array<Amino::String>&                types,
+    const Amino::Array<Amino::Ptr<Bifrost::Object>>& attribute_definitions)
+    USDNODE_DOC_ICON_X("define_prims",
+                       "define_prims",
+                       "usd.svg",
+                       "outName=success");
+
 /// \ingroup Prim
 /// \defgroup add_applied_schema add_applied_schema node
 ///
@@ -134,6 +134,7 @@ void USD::Stage::open_stage_from_layer(
 /// value semantics world. It should likely be reviewed.
 void USD::Stage::open_stage_from_cache(const Amino::long_t              id,
                                        const int                        layer_index,
+                                       const bool                       reuse_cached_stage,
                                        Amino::Ptr<BifrostUsd::Stage>&   stage) {
     auto stage_returns = createReturnGuard(stage);
     try {
@@ -142,10 +143,19 @@ void USD::Stage::open_stage_from_cache(const Amino::long_t              id,
             PXR_NS::UsdStageCache::Id::FromLongInt(static_cast<long int>(id)));
 
         if (pxr_stage) {
+            // Either wrap the cached UsdStage, which is copied on first
+            // modification, or reload a new one from its root layer:
             auto stage_ =
-                Amino::newMutablePtr<BifrostUsd::Stage>(BifrostUsd::Layer(
-                    pxr_stage->GetRootLayer()->GetIdentifier().c_str(),
-                    pxr_stage->GetRootLayer()->GetDisplayName().c_str()));
+                reuse_cached_stage
+                    ? Amino::newMutablePtr<BifrostUsd::Stage>(pxr_stage)
+                    : Amino::newMutablePtr<BifrostUsd::Stage>(
+                          BifrostUsd::Layer(
+                              pxr_stage->GetRootLayer()
+                                  ->GetIdentifier()
+                                  .c_str(),
+                              pxr_stage->GetRootLayer()
+                                  ->GetDisplayName()
+                                  .c_str()));
 
             // Reverse the given index to match the order of sublayers
             // in the Pixar USD Layer:
@@ -407,8 +417,7 @@ Amino::long_t USD::Stage::send_stage_to_cache(
 
     try {
         if (stage && *stage) {
-            auto usdStage =
-                const_cast<BifrostUsd::Stage&>(*stage).getStagePtr();
+            auto usdStage = stage->getSharedStagePtr();
             return PXR_NS::UsdUtilsStageCache::Get().Insert(usdStage).ToLongInt();
         }
 
@@ -435,6 +444,33 @@ void USD::Stage::export_stage_to_string(const BifrostUsd::Stage& stage,
     }
 }
 
+void USD::Stage::export_stage_to_string_chunks(
+    const BifrostUsd::Stage&                         stage,
+    Amino::MutablePtr<Amino::Array<Amino::String>>& chunks) {
+    chunks = Amino::newMutablePtr<Amino::Array<Amino::String>>();
+    if (!stage) return;
+
+    try {
+        auto flattened = stage->Flatten();
+        if (flattened) {
+            // Same documentation as the one added by UsdStage::ExportToString
+            std::string doc = flattened->GetDocumentation();
+            if (!doc.empty()) doc.append("\n\n");
+            doc.append("Generated from Composed Stage of root layer " +
+                       stage->GetRootLayer()->GetRealPath() + "\n");
+            flattened->SetDocumentation(doc);
+
+            BifrostUsd::Layer::exportToChunks(
+                *flattened, [&chunks](const std::string& chunk) {
+                    chunks->push_back(chunk.c_str());
+                    return true;
+                });
+        }
+    } catch (std::exception& e) {
+        log_exception("export_stage_to_string_chunks", e);
+    }
+}
+
 bool USD::Stage::export_stage_to_file(const BifrostUsd::Stage& stage,
                                       const Amino::String&       file) {
     if (!stage) return false;
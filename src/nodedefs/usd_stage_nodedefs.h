@@ -85,12 +85,22 @@ void open_stage_from_layer(const BifrostUsd::Layer&                 root_layer,
 ///                  If the sublayer index is -1 or if it does not identify an
 ///                  existing sublayer, the root layer is set as the EditTarget
 ///                  of the opened stage.
+/// \param [in] reuse_cached_stage If true, the cached stage is used as is
+///                  instead of being reloaded from its root layer. Its layers
+///                  are only copied when the stage is modified, and only the
+///                  root layer and the EditTarget layer are copied. Until
+///                  then, changes made to the cached stage are visible from
+///                  the output stage. If a layer_index other than -1 is
+///                  given, the root layer is copied right away to set the
+///                  EditTarget.
 ///
 /// \param [out] stage The USD stage.
 USD_NODEDEF_DECL
 void open_stage_from_cache(const Amino::long_t              id AMINO_ANNOTATE("Amino::Port metadata=[{UiSoftMin, string, 0}]"),
                            const int                        layer_index
                                AMINO_ANNOTATE("Amino::Port value=-1"),
+                           const bool                       reuse_cached_stage
+                               AMINO_ANNOTATE("Amino::Port value=false"),
                            Amino::Ptr<BifrostUsd::Stage>&   stage)
     USDNODE_DOC_ICON("open_stage_from_cache",
                      "open_stage_from_cache",
@@ -291,6 +301,25 @@ void export_stage_to_string(const BifrostUsd::Stage&    stage,
                      "export_stage_to_string",
                      "usd.svg");
 
+/// \ingroup Stage
+/// \defgroup export_stage_to_string_chunks export_stage_to_string_chunks node
+///
+/// \brief This node returns the composite scene as a flattened USD text
+/// representation, by chunks: one for the layer metadata and one for each
+/// root prim. It does not build a single string holding the whole text, but
+/// the stage is flattened first, and all the chunks are returned at once, so
+/// the memory used is still proportional to the size of the whole text.
+///
+/// \param [in] stage The USD stage.
+/// \param [out] chunks The flattened USD text representation, by chunks.
+USD_NODEDEF_DECL
+void export_stage_to_string_chunks(
+    const BifrostUsd::Stage&                         stage,
+    Amino::MutablePtr<Amino::Array<Amino::String>>& chunks)
+    USDNODE_DOC_ICON("export_stage_to_string_chunks",
+                     "export_stage_to_string_chunks",
+                     "usd.svg");
+
 /// \ingroup Stage
 /// \defgroup export_stage_to_file export_stage_to_file node
 ///
@@ -23,6 +23,9 @@
 #include <Amino/Core/String.h>
 #include <Bifrost/Math/Types.h>
 
+#include <cstring>
+#include <type_traits>
+
 #include "usd_utils.h"
 
 namespace USDTypeConverters {
@@ -85,6 +88,55 @@ template <typename T>
 struct BfType<PXR_NS::VtArray<T>>
     : public type_identity<Amino::Array<BfType_t<T>>> {};
 
+// Trait telling whether a Bifrost/Amino type and its Pxr counterpart have the
+// same memory layout. Arrays of such types are converted with a bulk memory
+// copy instead of element by element.
+
+template <typename BF, typename PXR>
+struct is_layout_compatible
+    : public std::integral_constant<bool, std::is_same<BF, PXR>::value &&
+                                              std::is_arithmetic<BF>::value &&
+                                              !std::is_same<BF, bool>::value> {
+};
+
+#define DEFINE_LAYOUT_COMPATIBLE(BF_TYPE, PXR_TYPE)                         \
+    template <>                                                             \
+    struct is_layout_compatible<BF_TYPE, PXR_TYPE> : public std::true_type { \
+        static_assert(sizeof(BF_TYPE) == sizeof(PXR_TYPE),                  \
+                      "Layout compatible types must have the same size");  \
+        static_assert(std::is_trivially_copyable<BF_TYPE>::value &&         \
+                          std::is_trivially_copyable<PXR_TYPE>::value,      \
+                      "Layout compatible types must be trivially copyable"); \
+    };
+// Bifrost matrices are stored column by column, and converted to the rows of
+// the Pxr matrices, so their memory layouts match too.
+DEFINE_LAYOUT_COMPATIBLE(Bifrost::Math::float2, PXR_NS::GfVec2f)
+DEFINE_LAYOUT_COMPATIBLE(Bifrost::Math::float3, PXR_NS::GfVec3f)
+DEFINE_LAYOUT_COMPATIBLE(Bifrost::Math::float4, PXR_NS::GfVec4f)
+DEFINE_LAYOUT_COMPATIBLE(Bifrost::Math::double2, PXR_NS::GfVec2d)
+DEFINE_LAYOUT_COMPATIBLE(Bifrost::Math::double3, PXR_NS::GfVec3d)
+DEFINE_LAYOUT_COMPATIBLE(Bifrost::Math::double4, PXR_NS::GfVec4d)
+DEFINE_LAYOUT_COMPATIBLE(Bifrost::Math::double2x2, PXR_NS::GfMatrix2d)
+DEFINE_LAYOUT_COMPATIBLE(Bifrost::Math::double3x3, PXR_NS::GfMatrix3d)
+DEFINE_LAYOUT_COMPATIBLE(Bifrost::Math::double4x4, PXR_NS::GfMatrix4d)
+#undef DEFINE_LAYOUT_COMPATIBLE
+
+template <typename BF, typename PXR>
+constexpr bool is_layout_compatible_v = is_layout_compatible<BF, PXR>::value;
+
+/// Copies the given number of elements from a source buffer to a destination
+/// buffer of a layout compatible type.
+template <typename DEST, typename SRC>
+inline void copy_layout_compatible(DEST* dest, const SRC* src, size_t count) {
+    static_assert(is_layout_compatible_v<DEST, SRC> ||
+                      is_layout_compatible_v<SRC, DEST>,
+                  "Types must be layout compatible");
+    if (count > 0) {
+        std::memcpy(static_cast<void*>(dest), static_cast<const void*>(src),
+                    count * sizeof(SRC));
+    }
+}
+
 // Type conversions from Pxr types to Bifrost/Amino types, and vice versa.
 
 template <typename T>
@@ -151,8 +203,14 @@ template <typename T>
 inline BfType_t<PXR_NS::VtArray<T>> fromPxr(const PXR_NS::VtArray<T>& src) {
     BfType_t<PXR_NS::VtArray<T>> dest;
     dest.resize(src.size());
-    for (size_t i = 0; i < src.size(); i++) {
-        dest[i] = fromPxr(src[i]);
+    if constexpr (is_layout_compatible_v<BfType_t<T>, T>) {
+        if (!src.empty()) {
+            copy_layout_compatible(&dest[0], src.cdata(), src.size());
+        }
+    } else {
+        for (size_t i = 0; i < src.size(); i++) {
+            dest[i] = fromPxr(src[i]);
+        }
     }
     return dest;
 }
@@ -224,8 +282,14 @@ template <typename T>
 inline PxrType_t<Amino::Array<T>> toPxr(const Amino::Array<T>& src) {
     PxrType_t<Amino::Array<T>> dest;
     dest.resize(src.size());
-    for (size_t i = 0; i < src.size(); i++) {
-        dest[i] = toPxr(src[i]);
+    if constexpr (is_layout_compatible_v<T, PxrType_t<T>>) {
+        if (!src.empty()) {
+            copy_layout_compatible(dest.data(), &src[0], src.size());
+        }
+    } else {
+        for (size_t i = 0; i < src.size(); i++) {
+            dest[i] = toPxr(src[i]);
+        }
     }
     return dest;
 }
@@ -101,21 +101,18 @@ Amino::String ToString(const Bifrost::Math::double3& vec) {
 void copy_array(const Amino::Array<Bifrost::Math::float3>& src,
                 PXR_NS::VtVec3fArray&                         dest) {
     dest.resize(src.size());
-    for (size_t i = 0; i < src.size(); ++i) {
-        dest[i][0] = src[i].x;
-        dest[i][1] = src[i].y;
-        dest[i][2] = src[i].z;
+    if (!src.empty()) {
+        USDTypeConverters::copy_layout_compatible(dest.data(), &src[0],
+                                                  src.size());
     }
 }
 
 void copy_array(const Amino::Array<Bifrost::Math::float4>& src,
                 PXR_NS::VtVec4fArray&                         dest) {
     dest.resize(src.size());
-    for (size_t i = 0; i < src.size(); ++i) {
-        dest[i][0] = src[i].x;
-        dest[i][1] = src[i].y;
-        dest[i][2] = src[i].z;
-        dest[i][3] = src[i].w;
+    if (!src.empty()) {
+        USDTypeConverters::copy_layout_compatible(dest.data(), &src[0],
+                                                  src.size());
     }
 }
 
@@ -153,6 +150,19 @@ PXR_NS::UsdPrim get_prim_or_throw(Amino::String const&       prim_path,
     return pxr_prim;
 }
 
+PXR_NS::UsdPrim get_prim_at_path(const Amino::String& path,
+                                 BifrostUsd::Stage&   stage) {
+    stage.detach();
+    return get_prim_at_path(path, static_cast<const BifrostUsd::Stage&>(stage));
+}
+
+PXR_NS::UsdPrim get_prim_or_throw(Amino::String const& prim_path,
+                                  BifrostUsd::Stage&   stage) {
+    stage.detach();
+    return get_prim_or_throw(prim_path,
+                             static_cast<const BifrostUsd::Stage&>(stage));
+}
+
 Amino::String resolve_prim_path(const Amino::String&       path,
                                 const BifrostUsd::Stage& stage) {
     assert(stage.isValid());
@@ -41,10 +41,18 @@ BIFUSD_WARNING_DISABLE_MSC(4003)
 
 BIFUSD_WARNING_POP
 
+#include <cstring>
+#include <type_traits>
+
 namespace USDUtils {
 
 class VariantEditContext {
 public:
+    /// Stages that are about to be modified must be detached from their
+    /// copies before the edit context is set on their UsdStage.
+    explicit VariantEditContext(BifrostUsd::Stage& stage)
+        : VariantEditContext(detached(stage)) {}
+
     explicit VariantEditContext(const BifrostUsd::Stage& stage) {
         auto variantSet = stage.getLastModifedVariantSet();
         if (variantSet) {
@@ -65,6 +73,11 @@ public:
     VariantEditContext& operator=(VariantEditContext&&) = delete;
 
 private:
+    static const BifrostUsd::Stage& detached(BifrostUsd::Stage& stage) {
+        stage.detach();
+        return stage;
+    }
+
     using Ctx          = PXR_NS::UsdEditContext;
     using storage_type = std::aligned_storage_t<sizeof(Ctx), alignof(Ctx)>;
 
@@ -92,9 +105,18 @@ Amino::String ToString(const Bifrost::Math::double3& vec);
 
 template <class AMINOTYPE, class USDTYPE>
 void copy_array(const AMINOTYPE& src, USDTYPE& dest) {
+    using SrcElement  = std::decay_t<decltype(src[0])>;
+    using DestElement = std::decay_t<decltype(dest[0])>;
     dest.resize(src.size());
-    for (size_t i = 0; i < src.size(); ++i) {
-        dest[i] = src[i];
+    if constexpr (std::is_same<SrcElement, DestElement>::value &&
+                  std::is_trivially_copyable<SrcElement>::value) {
+        if (!src.empty()) {
+            std::memcpy(dest.data(), &src[0], src.size() * sizeof(SrcElement));
+        }
+    } else {
+        for (size_t i = 0; i < src.size(); ++i) {
+            dest[i] = src[i];
+        }
     }
 }
 
@@ -128,6 +150,17 @@ PXR_NS::UsdPrim get_prim_at_path(const Amino::String&       path,
 PXR_NS::UsdPrim get_prim_or_throw(Amino::String const&     prim_path,
                                BifrostUsd::Stage const& stage);
 
+/// Overloads used by nodes modifying the stage. The stage is detached from
+/// its copies before the prim is retrieved, so the returned prim can be
+/// modified without side effects on the copies.
+/// \{
+PXR_NS::UsdPrim get_prim_at_path(const Amino::String& path,
+                                 BifrostUsd::Stage&   stage);
+
+PXR_NS::UsdPrim get_prim_or_throw(Amino::String const& prim_path,
+                                  BifrostUsd::Stage&   stage);
+/// \}
+
 Amino::String resolve_prim_path(const Amino::String&       path,
                                 const BifrostUsd::Stage& stage);
 
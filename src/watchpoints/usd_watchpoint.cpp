@@ -37,9 +37,12 @@ class StringList;
 #include <BifrostUsd/Prim.h>
 #include <BifrostUsd/Stage.h>
 
-#include <map>
+#include "usd_watchpoint_stats.h"
+
 #include <mutex>
+#include <sstream>
 #include <string>
+#include <vector>
 
 // Note: To silence warnings coming from USD library
 #include <bifusd/config/CfgWarningMacros.h>
@@ -49,8 +52,6 @@ BIFUSD_WARNING_DISABLE_MSC(4267)
 BIFUSD_WARNING_DISABLE_MSC(4244)
 #include <pxr/usd/usd/attribute.h>
 #include <pxr/usd/usd/prim.h>
-#include <pxr/usd/usd/primRange.h>
-#include <pxr/usd/usd/primTypeInfo.h>
 
 BIFUSD_WARNING_POP
 
@@ -122,6 +123,9 @@ Amino::String const kStartTimeCode     = "start_time_code";
 Amino::String const kStartTimeCodeDesc = "The layer start time code";
 Amino::String const kEndTimeCode       = "end_time_code";
 Amino::String const kEndTimeCodeDesc   = "The layer end time code";
+Amino::String const kLayerExportedSize = "exported_size";
+Amino::String const kLayerExportedSizeDesc =
+    "The size in bytes of the layer exported as text";
 
 // XML formating
 std::string const kElement  = "element";
@@ -209,6 +213,9 @@ public:
     USDWPClientData(USDWPClientData&&)      = delete;
     virtual ~USDWPClientData()              = default;
 
+    /// Serializes the recordings of this watchpoint.
+    std::mutex& mutex() { return m_mutex; }
+
     void record(AttributePtr const& attribute);
     void record(ArrayOfAttributes const& attributes);
     void record(LayerPtr const& layer);
@@ -219,7 +226,9 @@ public:
     void record(ArrayOfPrims const& prims);
 
 private:
-    Records& m_recordedValues;
+    Records&        m_recordedValues;
+    std::mutex      m_mutex;
+    USDWPStageStats m_stageStats;
 };
 
 void addXmlElement(std::ostringstream& oss,
@@ -281,6 +290,8 @@ void USDWPClientData::record(LayerPtr const& layer) {
                       std::to_string(pxr_layer.GetStartTimeCode()));
         addXmlElement(oss, kEndTimeCode,
                       std::to_string(pxr_layer.GetEndTimeCode()));
+        addXmlElement(oss, kLayerExportedSize,
+                      std::to_string(layer->exportedSize()));
         m_recordedValues.set(pxr_layer.GetDisplayName().c_str(),
                              oss.str().c_str());
 
@@ -305,6 +316,8 @@ void USDWPClientData::record(LayerPtr const& layer) {
                           std::to_string(pxr_subLayer.GetStartTimeCode()));
             addXmlElement(subOss, kEndTimeCode,
                           std::to_string(pxr_subLayer.GetEndTimeCode()));
+            addXmlElement(subOss, kLayerExportedSize,
+                          std::to_string(subLayer.exportedSize()));
 
             m_recordedValues.set(subLayerDisplayName.c_str(),
                                  subOss.str().c_str());
@@ -354,42 +367,7 @@ void USDWPClientData::record(StagePtr const& stage) {
             layerStackString.append("\n");
         }
         m_recordedValues.set(kLayerStack, layerStackString);
-        unsigned int                        prim_count = 0;
-        std::map<std::string, unsigned int> prim_types;
-
-        /// Is TraverseAll() really non const?
-        for (const auto& prim :
-             const_cast<PXR_NS::UsdStage&>(stage->get()).TraverseAll()) {
-            prim_count++;
-            const PXR_NS::UsdPrimTypeInfo& prim_typeinfo = prim.GetPrimTypeInfo();
-            std::string                 type_name = prim_typeinfo.GetTypeName();
-            if (!type_name.empty()) {
-                if (prim_types.find(type_name) == prim_types.end()) {
-                    prim_types[type_name] = 1;
-                } else {
-                    prim_types[type_name] = prim_types[type_name] + 1;
-                }
-            }
-
-            const PXR_NS::TfTokenVector& applied_schemas =
-                prim_typeinfo.GetAppliedAPISchemas();
-            for (std::string const& schema : applied_schemas) {
-                if (!schema.empty() && schema != type_name) {
-                    if (prim_types.find(schema) == prim_types.end()) {
-                        prim_types[schema] = 1;
-                    } else {
-                        prim_types[schema] = prim_types[type_name] + 1;
-                    }
-                }
-            }
-        }
-        std::ostringstream ss;
-        ss << "Total Prims: " << std::to_string(prim_count) << std::endl;
-        for (auto const& prim_type : prim_types) {
-            ss << prim_type.first
-               << " Count: " << std::to_string(prim_type.second) << std::endl;
-        }
-        m_recordedValues.set(kStats, ss.str().c_str());
+        m_recordedValues.set(kStats, m_stageStats.get(*stage).c_str());
     }
 }
 
@@ -463,13 +441,12 @@ template <typename T>
 void wpCallBack(void const* data, Amino::ulong_t, void const* value) {
     if (data == nullptr || value == nullptr) return;
 
-    static std::mutex           s_mutex;
-    std::lock_guard<std::mutex> lock(s_mutex);
-
     auto* wpClientData =
         reinterpret_cast<USDWPClientData*>(const_cast<void*>(data));
     auto const* typedValue = reinterpret_cast<T const*>(value);
 
+    std::lock_guard<std::mutex> lock(wpClientData->mutex());
+
     wpClientData->record(*typedValue);
 }
 /// \}
@@ -0,0 +1,132 @@
+//-
+// Copyright 2023 Autodesk, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//+
+
+#include "usd_watchpoint_stats.h"
+
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <unordered_map>
+#include <vector>
+
+// Note: To silence warnings coming from USD library
+#include <bifusd/config/CfgWarningMacros.h>
+BIFUSD_WARNING_PUSH
+BIFUSD_WARNING_DISABLE_MSC(4003)
+BIFUSD_WARNING_DISABLE_MSC(4267)
+BIFUSD_WARNING_DISABLE_MSC(4244)
+#include <pxr/base/work/loops.h>
+#include <pxr/usd/usd/prim.h>
+#include <pxr/usd/usd/primRange.h>
+#include <pxr/usd/usd/primTypeInfo.h>
+BIFUSD_WARNING_POP
+
+namespace {
+using PrimTypeCounts = std::unordered_map<PXR_NS::TfToken,
+                                          unsigned int,
+                                          PXR_NS::TfToken::HashFunctor>;
+
+void countPrim(PXR_NS::UsdPrim const& prim,
+               unsigned int&          primCount,
+               PrimTypeCounts&        primTypes) {
+    ++primCount;
+    const PXR_NS::UsdPrimTypeInfo& primTypeInfo = prim.GetPrimTypeInfo();
+    const PXR_NS::TfToken&         typeName     = primTypeInfo.GetTypeName();
+    if (!typeName.IsEmpty()) {
+        ++primTypes[typeName];
+    }
+    for (const auto& schema : primTypeInfo.GetAppliedAPISchemas()) {
+        if (!schema.IsEmpty() && schema != typeName) {
+            ++primTypes[schema];
+        }
+    }
+}
+} // namespace
+
+std::string computeStageStats(PXR_NS::UsdStage const& stage) {
+    const auto predicate = PXR_NS::UsdPrimAllPrimsPredicate;
+
+    unsigned int                 primCount = 0;
+    PrimTypeCounts               primTypes;
+    std::vector<PXR_NS::UsdPrim> subtrees;
+    for (const auto& root :
+         stage.GetPseudoRoot().GetFilteredChildren(predicate)) {
+        countPrim(root, primCount, primTypes);
+        for (const auto& child : root.GetFilteredChildren(predicate)) {
+            subtrees.push_back(child);
+        }
+    }
+
+    std::mutex mergeMutex;
+    PXR_NS::WorkParallelForN(subtrees.size(), [&](size_t begin, size_t end) {
+        unsigned int   localPrimCount = 0;
+        PrimTypeCounts localPrimTypes;
+        for (size_t i = begin; i < end; ++i) {
+            for (const auto& prim :
+                 PXR_NS::UsdPrimRange(subtrees[i], predicate)) {
+                countPrim(prim, localPrimCount, localPrimTypes);
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(mergeMutex);
+        primCount += localPrimCount;
+        for (const auto& primType : localPrimTypes) {
+            primTypes[primType.first] += primType.second;
+        }
+    });
+
+    // Sorted by type name.
+    std::map<std::string, unsigned int> sortedPrimTypes;
+    for (const auto& primType : primTypes) {
+        sortedPrimTypes[primType.first.GetString()] = primType.second;
+    }
+
+    std::ostringstream ss;
+    ss << "Total Prims: " << std::to_string(primCount) << std::endl;
+    for (auto const& prim_type : sortedPrimTypes) {
+        ss << prim_type.first
+           << " Count: " << std::to_string(prim_type.second) << std::endl;
+    }
+    return ss.str();
+}
+
+USDWPStageStats::~USDWPStageStats() { PXR_NS::TfNotice::Revoke(m_key); }
+
+std::string const& USDWPStageStats::get(BifrostUsd::Stage const& stage) {
+    const PXR_NS::UsdStageWeakPtr stagePtr(stage.getSharedStagePtr());
+    if (stagePtr != m_stage) {
+        PXR_NS::TfNotice::Revoke(m_key);
+        m_stage = stagePtr;
+        m_key   = PXR_NS::TfNotice::Register(PXR_NS::TfCreateWeakPtr(this),
+                                             &USDWPStageStats::onObjectsChanged,
+                                             m_stage);
+        m_dirty = true;
+    }
+    if (m_dirty.exchange(false)) {
+        m_stats = computeStageStats(stage.get());
+    }
+    return m_stats;
+}
+
+void USDWPStageStats::onObjectsChanged(
+    PXR_NS::UsdNotice::ObjectsChanged const& notice,
+    PXR_NS::UsdStageWeakPtr const& /*sender*/) {
+    // Prims added, removed or whose type or applied schemas changed are
+    // resynced. Other changes do not affect the stats.
+    if (!notice.GetResyncedPaths().empty()) {
+        m_dirty = true;
+    }
+}
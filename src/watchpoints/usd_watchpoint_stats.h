@@ -0,0 +1,73 @@
+//-
+// Copyright 2023 Autodesk, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//+
+
+/// \file usd_watchpoint_stats.h
+///
+/// \brief The stage stats displayed by the USD watchpoint
+///
+
+#ifndef USD_WATCHPOINT_STATS_H
+#define USD_WATCHPOINT_STATS_H
+
+#include <BifrostUsd/Stage.h>
+
+#include <atomic>
+#include <string>
+
+// Note: To silence warnings coming from USD library
+#include <bifusd/config/CfgWarningMacros.h>
+BIFUSD_WARNING_PUSH
+BIFUSD_WARNING_DISABLE_MSC(4003)
+BIFUSD_WARNING_DISABLE_MSC(4267)
+BIFUSD_WARNING_DISABLE_MSC(4244)
+#include <pxr/base/tf/notice.h>
+#include <pxr/base/tf/weakBase.h>
+#include <pxr/usd/usd/notice.h>
+#include <pxr/usd/usd/stage.h>
+BIFUSD_WARNING_POP
+
+/// Counts the prims of the stage, and the prims of each type and applied
+/// schema, as TraverseAll() would. The subtrees below the root prims are
+/// traversed in parallel.
+/// \returns The counts, one per line, the prim types sorted by name.
+std::string computeStageStats(PXR_NS::UsdStage const& stage);
+
+/// \brief The stats of the last stage recorded by a watchpoint.
+///
+/// The stats are traversed again only for another stage, or when prims of
+/// the stage were resynced since they were computed.
+class USDWPStageStats : public PXR_NS::TfWeakBase {
+public:
+    USDWPStageStats() = default;
+    USDWPStageStats(USDWPStageStats const&) = delete;
+    USDWPStageStats(USDWPStageStats&&)      = delete;
+    ~USDWPStageStats();
+
+    /// Not thread safe, the calls must be serialized by the caller.
+    std::string const& get(BifrostUsd::Stage const& stage);
+
+private:
+    void onObjectsChanged(PXR_NS::UsdNotice::ObjectsChanged const& notice,
+                          PXR_NS::UsdStageWeakPtr const&           sender);
+
+    PXR_NS::UsdStageWeakPtr m_stage;
+    PXR_NS::TfNotice::Key   m_key;
+    std::string             m_stats;
+    /// Set by the notices, which may be sent by another thread.
+    std::atomic<bool> m_dirty{true};
+};
+
+#endif /* USD_WATCHPOINT_STATS_H */
@@ -408,6 +408,96 @@ TEST(BifrostUsdTests, createLayerWithSubLayer) {
         << subFilename.c_str() << "`\n";
 }
 
+TEST(BifrostUsdTests, exportToFileWithSubLayers) {
+    const Amino::String rootFilename{"exportToFileWithSubLayers_root.usda"};
+    Amino::String       rootFilePath = getThisTestOutputPath(rootFilename);
+    BifrostUsd::Layer   rootLayer{rootFilename};
+    rootLayer.setFilePath(rootFilePath);
+
+    // Each sublayer has its own sublayer, so that the sublayers are exported
+    // concurrently at every level of the hierarchy.
+    const int                  numSubLayers = 8;
+    std::vector<Amino::String> subFilePaths;
+    for (int i = 0; i < numSubLayers; ++i) {
+        const std::string prefix =
+            "exportToFileWithSubLayers_sub" + std::to_string(i);
+        Amino::String subFilePath =
+            getThisTestOutputPath((prefix + ".usd").c_str());
+        Amino::String subSubFilePath =
+            getThisTestOutputPath((prefix + "_sub.usd").c_str());
+
+        BifrostUsd::Layer subSubLayer{(prefix + "_sub.usd").c_str()};
+        subSubLayer.setFilePath(subSubFilePath);
+        subSubLayer->SetComment(prefix + "_sub");
+
+        BifrostUsd::Layer subLayer{(prefix + ".usd").c_str()};
+        subLayer.setFilePath(subFilePath);
+        ASSERT_TRUE(subLayer.insertSubLayer(subSubLayer));
+        ASSERT_TRUE(rootLayer.insertSubLayer(subLayer));
+
+        subFilePaths.push_back(subFilePath);
+        subFilePaths.push_back(subSubFilePath);
+    }
+
+    ASSERT_TRUE(rootLayer.exportToFile(rootFilePath, true));
+    ASSERT_TRUE(Bifrost::FileUtils::filePathExists(rootFilePath));
+    for (const auto& subFilePath : subFilePaths) {
+        ASSERT_TRUE(Bifrost::FileUtils::filePathExists(subFilePath))
+            << subFilePath.c_str() << " was not exported.\n";
+    }
+
+    // The saved root layer refers to its sublayers by their relative paths.
+    auto savedLayer = PXR_NS::SdfLayer::OpenAsAnonymous(rootFilePath.c_str());
+    ASSERT_TRUE(savedLayer);
+    ASSERT_EQ(savedLayer->GetNumSubLayerPaths(),
+              static_cast<size_t>(numSubLayers));
+    for (const auto& subLayerPath : savedLayer->GetSubLayerPaths()) {
+        EXPECT_EQ(std::string(subLayerPath).find('/'), std::string::npos)
+            << subLayerPath << " is not relative to the root layer.\n";
+    }
+
+    // Exporting a layer without sublayers to rewrite writes its content as
+    // is, and the file can be exported again.
+    const auto& subSubLayer = rootLayer.getSubLayer(0).getSubLayer(0);
+    ASSERT_TRUE(subSubLayer.exportToFile());
+    auto savedSubSubLayer =
+        PXR_NS::SdfLayer::OpenAsAnonymous(subSubLayer.getFilePath().c_str());
+    ASSERT_TRUE(savedSubSubLayer);
+    EXPECT_EQ(savedSubSubLayer->GetComment(), subSubLayer->GetComment());
+}
+
+TEST(BifrostUsdTests, exportToFileWithSharedSubLayer) {
+    const Amino::String rootFilename{
+        "exportToFileWithSharedSubLayer_root.usda"};
+    Amino::String       rootFilePath = getThisTestOutputPath(rootFilename);
+    BifrostUsd::Layer   rootLayer{rootFilename};
+    rootLayer.setFilePath(rootFilePath);
+
+    // Two sublayers share the same sublayer file, which must be exported
+    // once, and not concurrently by the two sublayers.
+    const Amino::String sharedFilename{
+        "exportToFileWithSharedSubLayer_shared.usd"};
+    Amino::String sharedFilePath = getThisTestOutputPath(sharedFilename);
+    for (int i = 0; i < 2; ++i) {
+        const std::string prefix =
+            "exportToFileWithSharedSubLayer_sub" + std::to_string(i);
+        BifrostUsd::Layer sharedLayer{sharedFilename};
+        sharedLayer.setFilePath(sharedFilePath);
+        sharedLayer->SetComment("shared");
+
+        BifrostUsd::Layer subLayer{(prefix + ".usd").c_str()};
+        subLayer.setFilePath(getThisTestOutputPath((prefix + ".usd").c_str()));
+        ASSERT_TRUE(subLayer.insertSubLayer(sharedLayer));
+        ASSERT_TRUE(rootLayer.insertSubLayer(subLayer));
+    }
+
+    ASSERT_TRUE(rootLayer.exportToFile(rootFilePath, true));
+    auto savedSharedLayer =
+        PXR_NS::SdfLayer::OpenAsAnonymous(sharedFilePath.c_str());
+    ASSERT_TRUE(savedSharedLayer);
+    EXPECT_EQ(savedSharedLayer->GetComment(), "shared");
+}
+
 TEST(BifrostUsdTests, getSubLayer) {
     // Open a root SdfLayer with some sub SdfLayers in it:
     const Amino::String rootName = "helloworld.usd";
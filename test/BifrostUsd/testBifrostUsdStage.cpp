@@ -22,8 +22,14 @@
 #include <BifrostUsd/Stage.h>
 #include <utils/test/testUtils.h>
 
+#include <pxr/usd/sdf/changeBlock.h>
+#include <pxr/usd/sdf/primSpec.h>
+
 #include <gtest/gtest.h>
+#include <chrono>
+#include <iostream>
 #include <string>
+#include <utility>
 #include <vector>
 
 using namespace BifrostUsd::TestUtils;
@@ -100,32 +106,50 @@ void reasonablyEqual(const BifrostUsd::Stage& lhs,
 
 void testCopyAndMoveOps(const BifrostUsd::Stage& stage) {
     // copy ctor & equality op
-    // Note: a new Anonymous root layer is created in the copy if root layer
-    //       in source stage is editable, hence they are not equal anymore.
+    // Note: the copy shares the root layer and the UsdStage of the source
+    //       stage until one of them is modified.
     BifrostUsd::Stage stageCopyCtor{stage}; // NOLINT(performance-unnecessary-copy-initialization)
     reasonablyEqual(stage, stageCopyCtor);
 
     // assignment op & equality op
-    // Note: a new Anonymous root layer is created in the copy if root layer
-    //       in source stage is editable, hence they are not equal anymore.
     BifrostUsd::Stage stageAssignOp;
     stageAssignOp.    operator=(stage);
     reasonablyEqual(stage, stageAssignOp);
 
     // move ctor & equality op
-    // Note: a new Anonymous root layer is created in the copy if root layer
-    //       in source stage is editable, hence they are not equal anymore.
     BifrostUsd::Stage stage2{stage};
     BifrostUsd::Stage stageMoveCtor{std::move(stage2)};
     reasonablyEqual(stage, stageMoveCtor);
 
     // move assignment op & equality op
-    // Note: a new Anonymous root layer is created in the copy if root layer
-    //       in source stage is editable, hence they are not equal anymore.
     BifrostUsd::Stage stage3{stage};
     BifrostUsd::Stage stageMoveAssignOp;
     stageMoveAssignOp.operator=(std::move(stage3));
     reasonablyEqual(stage, stageMoveAssignOp);
+
+    // modified copy
+    // Note: a new Anonymous root layer is created in the copy when it is
+    //       modified if root layer in source stage is editable.
+    BifrostUsd::Stage stageModified{stage};
+    stageModified.detach();
+    reasonablyEqual(stage, stageModified);
+}
+
+// Creates an anonymous layer with numGroups * numPrimsPerGroup prims.
+PXR_NS::SdfLayerRefPtr createLayerWithPrims(int numGroups,
+                                            int numPrimsPerGroup) {
+    auto layer = PXR_NS::SdfLayer::CreateAnonymous("prims.usda");
+    PXR_NS::SdfChangeBlock changeBlock;
+    for (int i = 0; i < numGroups; ++i) {
+        auto group = PXR_NS::SdfPrimSpec::New(
+            layer, "grp" + std::to_string(i), PXR_NS::SdfSpecifierDef,
+            "Xform");
+        for (int j = 0; j < numPrimsPerGroup; ++j) {
+            PXR_NS::SdfPrimSpec::New(group, "prim" + std::to_string(j),
+                                     PXR_NS::SdfSpecifierDef, "Xform");
+        }
+    }
+    return layer;
 }
 } // namespace
 
@@ -283,3 +307,148 @@ TEST(BifrostUsdTests, Stage_ctors) {
         }
     }
 }
+
+TEST(BifrostUsdTests, Stage_copy_on_write) {
+    const Amino::String               rootName = "helloworld.usd";
+    const Amino::Array<Amino::String> subNames = {"Grass1.usd", "Grass2.usd",
+                                                  "Mushroom1.usd"};
+
+    PXR_NS::SdfLayerRefPtr sdfRootLayer =
+        PXR_NS::SdfLayer::FindOrOpen(rootName.c_str());
+    ASSERT_NE(sdfRootLayer, nullptr);
+    Amino::String errorMsg;
+    addSubLayers(sdfRootLayer, subNames, errorMsg);
+    ASSERT_STREQ("", errorMsg.c_str());
+
+    BifrostUsd::Layer layer{sdfRootLayer, true};
+    BifrostUsd::Stage stage{layer};
+    ASSERT_TRUE(stage.setEditLayerIndex(1, false));
+
+    // A copy shares everything with its source.
+    BifrostUsd::Stage copy{stage};
+    const auto&       constStage = std::as_const(stage);
+    const auto&       constCopy  = std::as_const(copy);
+    EXPECT_EQ(constStage.getRootLayer(), constCopy.getRootLayer());
+    EXPECT_EQ(&constStage.get(), &constCopy.get());
+
+    // Modifying the copy detaches it: only its root layer and its EditTarget
+    // sublayer are copied.
+    const PXR_NS::SdfPath primPath("/copy_on_write");
+    copy->DefinePrim(primPath);
+    EXPECT_TRUE(constCopy->GetPrimAtPath(primPath));
+    EXPECT_FALSE(constStage->GetPrimAtPath(primPath));
+
+    EXPECT_NE(constStage.getRootLayer(), constCopy.getRootLayer());
+    EXPECT_NE(&constStage.get(), &constCopy.get());
+    const auto& rootLayer     = *constStage.getRootLayer();
+    const auto& copyRootLayer = *constCopy.getRootLayer();
+    EXPECT_EQ(rootLayer.getSubLayer(0).operator->(),
+              copyRootLayer.getSubLayer(0).operator->());
+    EXPECT_NE(rootLayer.getSubLayer(1).operator->(),
+              copyRootLayer.getSubLayer(1).operator->());
+    EXPECT_EQ(rootLayer.getSubLayer(2).operator->(),
+              copyRootLayer.getSubLayer(2).operator->());
+    EXPECT_EQ(copyRootLayer.getSubLayer(1).operator->(),
+              constCopy->GetEditTarget().GetLayer().operator->());
+    reasonablyEqual(stage, copy);
+
+    // Targeting a sublayer that is still shared detaches it.
+    ASSERT_TRUE(copy.setEditLayerIndex(2, false));
+    EXPECT_NE(rootLayer.getSubLayer(2).operator->(),
+              copyRootLayer.getSubLayer(2).operator->());
+    EXPECT_EQ(copyRootLayer.getSubLayer(2).operator->(),
+              constCopy->GetEditTarget().GetLayer().operator->());
+
+    // The source is now the only owner of its root layer and of its
+    // EditTarget sublayer, which are modified in place.
+    const auto* sourceRootLayer = &*constStage.getRootLayer();
+    const auto* sourceEditLayer = rootLayer.getSubLayer(1).operator->();
+    stage->DefinePrim(PXR_NS::SdfPath("/source_only"));
+    EXPECT_EQ(sourceRootLayer, &*constStage.getRootLayer());
+    EXPECT_EQ(sourceEditLayer,
+              constStage.getRootLayer()->getSubLayer(1).operator->());
+    EXPECT_FALSE(constCopy->GetPrimAtPath(PXR_NS::SdfPath("/source_only")));
+}
+
+TEST(BifrostUsdTests, Stage_wrapped_edit_target) {
+    const Amino::String               rootName = "wrapped_edit_target.usd";
+    const Amino::Array<Amino::String> subNames = {"Grass1.usd", "Grass2.usd"};
+
+    PXR_NS::SdfLayerRefPtr sdfRootLayer =
+        PXR_NS::SdfLayer::CreateAnonymous(rootName.c_str());
+    ASSERT_NE(sdfRootLayer, nullptr);
+    Amino::String errorMsg;
+    addSubLayers(sdfRootLayer, subNames, errorMsg);
+    ASSERT_STREQ("", errorMsg.c_str());
+
+    auto usdStage = PXR_NS::UsdStage::Open(sdfRootLayer);
+    ASSERT_TRUE(usdStage);
+    auto subLayer = PXR_NS::SdfLayer::FindRelativeToLayer(
+        sdfRootLayer, sdfRootLayer->GetSubLayerPaths()[1]);
+    ASSERT_TRUE(subLayer);
+    usdStage->SetEditTarget(subLayer);
+
+    // The EditTarget of the wrapped UsdStage is reported.
+    BifrostUsd::Stage stage{usdStage};
+    EXPECT_EQ(stage.getEditLayerIndex(), 1);
+
+    // Targeting the root layer is not skipped.
+    ASSERT_TRUE(stage.setEditLayerIndex(-1, false));
+    EXPECT_EQ(stage.getEditLayerIndex(), -1);
+    EXPECT_EQ(std::as_const(stage)->GetEditTarget().GetLayer(),
+              std::as_const(stage)->GetRootLayer());
+}
+
+// Benchmark of a 50-way fan-out of a 1M-prim stage. Disabled by default,
+// run it with --gtest_also_run_disabled_tests.
+TEST(BifrostUsdTests, DISABLED_Stage_fan_out_benchmark) {
+    const int numCopies = 50;
+
+    // The 1M prims are in a sublayer, new prims are authored in the root
+    // layer.
+    BifrostUsd::Layer rootLayer;
+    ASSERT_TRUE(rootLayer.insertSubLayer(
+        BifrostUsd::Layer{createLayerWithPrims(1000, 1000), true}));
+    BifrostUsd::Stage stage{rootLayer};
+    ASSERT_TRUE(stage);
+
+    using Clock   = std::chrono::steady_clock;
+    auto elapsed = [](Clock::time_point start) {
+        return std::chrono::duration<double>(Clock::now() - start).count();
+    };
+
+    // Copies that are read and modified, like the outputs of a fan-out of
+    // stage nodes.
+    auto fanOut = [&](auto&& copyStage) {
+        std::vector<BifrostUsd::Stage> copies;
+        copies.reserve(numCopies);
+        for (int i = 0; i < numCopies; ++i) {
+            copies.push_back(copyStage(stage));
+            EXPECT_TRUE(std::as_const(copies.back())
+                            ->GetPrimAtPath(PXR_NS::SdfPath("/grp999/prim999")));
+        }
+        for (int i = 0; i < numCopies; ++i) {
+            copies[i]->DefinePrim(
+                PXR_NS::SdfPath("/copy" + std::to_string(i)));
+        }
+    };
+
+    auto start = Clock::now();
+    fanOut([](const BifrostUsd::Stage& source) {
+        // Deep copy of all editable layers.
+        return BifrostUsd::Stage{*source.getRootLayer()};
+    });
+    const double deepCopyTime = elapsed(start);
+
+    start = Clock::now();
+    fanOut([](const BifrostUsd::Stage& source) {
+        return BifrostUsd::Stage{source}; // NOLINT(performance-unnecessary-copy-initialization)
+    });
+    const double copyOnWriteTime = elapsed(start);
+
+    std::cout << numCopies << "-way fan-out of a 1M-prim stage:\n"
+              << "    deep copies:          " << deepCopyTime << " s\n"
+              << "    copy-on-write copies: " << copyOnWriteTime << " s"
+              << std::endl;
+    EXPECT_LT(copyOnWriteTime, deepCopyTime);
+}
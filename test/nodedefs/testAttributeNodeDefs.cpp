@@ -19,6 +19,7 @@
 #include <nodedefs/usd_pack/usd_geom_nodedefs.h>
 #include <nodedefs/usd_pack/usd_prim_nodedefs.h>
 #include <nodedefs/usd_pack/usd_stage_nodedefs.h>
+#include <nodedefs/usd_pack/usd_type_converter.h>
 #include <utils/test/testUtils.h>
 
 BIFUSD_WARNING_PUSH
@@ -26,7 +27,9 @@ BIFUSD_WARNING_DISABLE_MSC(4003)
 #include <pxr/usd/usd/references.h>
 BIFUSD_WARNING_POP
 
+#include <chrono>
 #include <cstdlib>
+#include <iostream>
 #include <string>
 #include <type_traits>
 
@@ -1026,3 +1029,219 @@ TEST(AttributeNodeDefs, clear_attribute_connections) {
     ASSERT_FALSE(targetAttr.GetConnections(&sources));
     ASSERT_EQ(sources.size(), 0);
 }
+
+TEST(AttributeNodeDefs, layout_compatible_array_conversion) {
+    using namespace USDTypeConverters;
+    static_assert(is_layout_compatible_v<Amino::int_t, int>, "");
+    static_assert(is_layout_compatible_v<Amino::double_t, double>, "");
+    static_assert(
+        is_layout_compatible_v<Bifrost::Math::float3, PXR_NS::GfVec3f>, "");
+    static_assert(
+        is_layout_compatible_v<Bifrost::Math::double4x4, PXR_NS::GfMatrix4d>,
+        "");
+    static_assert(!is_layout_compatible_v<Amino::String, std::string>, "");
+    static_assert(!is_layout_compatible_v<Amino::bool_t, bool>, "");
+
+    Amino::Array<Bifrost::Math::float3> points{{1.f, 2.f, 3.f},
+                                               {4.f, 5.f, 6.f}};
+    auto pxrPoints = toPxr(points);
+    ASSERT_EQ(pxrPoints.size(), 2u);
+    ASSERT_EQ(pxrPoints[1], PXR_NS::GfVec3f(4.f, 5.f, 6.f));
+    auto bfPoints = fromPxr(pxrPoints);
+    ASSERT_EQ(bfPoints.size(), 2u);
+    ASSERT_EQ(bfPoints[1].x, 4.f);
+    ASSERT_EQ(bfPoints[1].z, 6.f);
+
+    // The memory copy of matrices must match the element wise conversion.
+    Bifrost::Math::double4x4 matrix{{1, 2, 3, 4},
+                                    {5, 6, 7, 8},
+                                    {9, 10, 11, 12},
+                                    {13, 14, 15, 16}};
+    Amino::Array<Bifrost::Math::double4x4> matrices{matrix};
+    auto pxrMatrices = toPxr(matrices);
+    ASSERT_EQ(pxrMatrices.size(), 1u);
+    ASSERT_EQ(pxrMatrices[0], toPxr(matrix));
+    ASSERT_EQ(pxrMatrices[0][1][2], 7.0);
+    ASSERT_EQ(fromPxr(pxrMatrices)[0].c3.w, 16.0);
+
+    Amino::Array<Amino::String> strings{"a", "b"};
+    auto pxrStrings = toPxr(strings);
+    ASSERT_EQ(pxrStrings[1], "b");
+
+    Amino::Array<int> empty;
+    ASSERT_TRUE(toPxr(empty).empty());
+    ASSERT_TRUE(fromPxr(PXR_NS::VtIntArray()).empty());
+}
+
+TEST(AttributeNodeDefs, get_prim_attribute_samples) {
+    BifrostUsd::Stage stage;
+    for (const char* path : {"/a", "/b"}) {
+        auto prim = stage->DefinePrim(PXR_NS::SdfPath(path));
+        auto attr = prim.CreateAttribute(PXR_NS::TfToken("size"),
+                                         PXR_NS::SdfValueTypeNames->Float);
+        attr.Set(1.f, 1.0);
+        attr.Set(3.f, 3.0);
+    }
+    // "/b" also has a half attribute, "/a" does not.
+    auto half = stage->GetPrimAtPath(PXR_NS::SdfPath("/b"))
+                    .CreateAttribute(PXR_NS::TfToken("weight"),
+                                     PXR_NS::SdfValueTypeNames->Half);
+    half.Set(PXR_NS::GfHalf(0.5f));
+
+    Amino::Array<Amino::String> primPaths{"/a", "/b", "/missing"};
+    Amino::Array<Amino::String> names{"size", "weight"};
+    Amino::Array<float>         frames{1.f, 2.f, 3.f};
+
+    Amino::MutablePtr<Amino::Array<float>> values;
+    Amino::MutablePtr<Amino::Array<bool>>  found;
+    ASSERT_FALSE(USD::Attribute::get_prim_attribute_samples(
+        stage, primPaths, names, frames, 0.f, values, found));
+    ASSERT_TRUE(values);
+    ASSERT_TRUE(found);
+    ASSERT_EQ(values->size(), 3u * 2u * 3u);
+    ASSERT_EQ(found->size(), 3u * 2u);
+
+    // Values are packed by prim, then by attribute, then by frame.
+    ASSERT_TRUE((*found)[0]);
+    ASSERT_FLOAT_EQ((*values)[0], 1.f);
+    ASSERT_FLOAT_EQ((*values)[1], 2.f);
+    ASSERT_FLOAT_EQ((*values)[2], 3.f);
+    ASSERT_FALSE((*found)[1]);
+    ASSERT_TRUE((*found)[2]);
+    ASSERT_FLOAT_EQ((*values)[(1 * 2 + 0) * 3 + 1], 2.f);
+    ASSERT_TRUE((*found)[3]);
+    ASSERT_FLOAT_EQ((*values)[(1 * 2 + 1) * 3 + 2], 0.5f);
+    ASSERT_FALSE((*found)[4]);
+    ASSERT_FALSE((*found)[5]);
+
+    Amino::Array<Amino::String> validPaths{"/a", "/b"};
+    Amino::Array<Amino::String> sizeName{"size"};
+    ASSERT_TRUE(USD::Attribute::get_prim_attribute_samples(
+        stage, validPaths, sizeName, frames, 0.f, values, found));
+    ASSERT_EQ(values->size(), 2u * 3u);
+}
+
+TEST(AttributeNodeDefs, get_prim_attribute_samples_array) {
+    BifrostUsd::Stage stage;
+    auto prim = stage->DefinePrim(PXR_NS::SdfPath("/a"));
+    auto attr = prim.CreateAttribute(PXR_NS::TfToken("points"),
+                                     PXR_NS::SdfValueTypeNames->Point3fArray);
+    attr.Set(PXR_NS::VtVec3fArray{{0, 0, 0}}, 1.0);
+    attr.Set(PXR_NS::VtVec3fArray{{1, 1, 1}, {2, 2, 2}}, 2.0);
+
+    Amino::Array<Amino::String> primPaths{"/a", "/missing"};
+    Amino::Array<Amino::String> names{"points"};
+    Amino::Array<float>         frames{1.f, 2.f};
+
+    Amino::MutablePtr<
+        Amino::Array<Amino::Ptr<Amino::Array<Bifrost::Math::float3>>>>
+                                          values;
+    Amino::MutablePtr<Amino::Array<bool>> found;
+    ASSERT_FALSE(USD::Attribute::get_prim_attribute_samples(
+        stage, primPaths, names, frames,
+        Amino::Array<Bifrost::Math::float3>{}, values, found));
+    ASSERT_TRUE(values);
+    ASSERT_TRUE(found);
+    ASSERT_EQ(values->size(), 2u * 1u * 2u);
+    ASSERT_EQ(found->size(), 2u);
+
+    // Each frame gets its own array.
+    ASSERT_TRUE((*found)[0]);
+    ASSERT_EQ((*values)[0]->size(), 1u);
+    ASSERT_EQ((*values)[1]->size(), 2u);
+    ASSERT_FLOAT_EQ((*(*values)[1])[1].x, 2.f);
+    ASSERT_FALSE((*found)[1]);
+    ASSERT_TRUE((*values)[2]);
+    ASSERT_TRUE((*values)[2]->empty());
+}
+
+TEST(AttributeNodeDefs, set_prims_attribute) {
+    BifrostUsd::Stage stage;
+    for (const char* path : {"/a", "/b"}) {
+        auto prim = stage->DefinePrim(PXR_NS::SdfPath(path));
+        prim.CreateAttribute(PXR_NS::TfToken("color"),
+                             PXR_NS::SdfValueTypeNames->Color3f);
+        prim.CreateAttribute(PXR_NS::TfToken("weight"),
+                             PXR_NS::SdfValueTypeNames->Half);
+    }
+
+    Amino::Array<Amino::String>         paths{"/a", "/b"};
+    Amino::Array<Bifrost::Math::float3> colors{{1, 0, 0}, {0, 1, 0}};
+    ASSERT_TRUE(USD::Attribute::set_prims_attribute(stage, paths, "color",
+                                                    colors, false, 0.f));
+    ASSERT_TRUE(USD::Attribute::set_prims_attribute(stage, paths, "color",
+                                                    colors, true, 2.f));
+
+    PXR_NS::GfVec3f color;
+    auto attrB = stage->GetPrimAtPath(PXR_NS::SdfPath("/b"))
+                     .GetAttribute(PXR_NS::TfToken("color"));
+    ASSERT_TRUE(attrB.Get(&color));
+    ASSERT_EQ(color, PXR_NS::GfVec3f(0, 1, 0));
+    ASSERT_TRUE(attrB.Get(&color, 2.0));
+    ASSERT_EQ(color, PXR_NS::GfVec3f(0, 1, 0));
+    ASSERT_EQ(attrB.GetNumTimeSamples(), 1u);
+
+    // Values are converted to the type of the attribute.
+    Amino::Array<float> weights{0.25f, 0.5f};
+    ASSERT_TRUE(USD::Attribute::set_prims_attribute(stage, paths, "weight",
+                                                    weights, false, 0.f));
+    PXR_NS::GfHalf weight;
+    ASSERT_TRUE(stage->GetPrimAtPath(PXR_NS::SdfPath("/a"))
+                    .GetAttribute(PXR_NS::TfToken("weight"))
+                    .Get(&weight));
+    ASSERT_EQ(static_cast<float>(weight), 0.25f);
+
+    // Values of the wrong type are refused.
+    Amino::Array<Amino::int_t> ints{1, 2};
+    ASSERT_FALSE(USD::Attribute::set_prims_attribute(stage, paths, "weight",
+                                                     ints, false, 0.f));
+
+    // Missing prims are reported, but the other prims are still set.
+    Amino::Array<Amino::String>         missing{"/a", "/missing"};
+    Amino::Array<Bifrost::Math::float3> blue{{0, 0, 1}, {0, 0, 1}};
+    ASSERT_FALSE(USD::Attribute::set_prims_attribute(stage, missing, "color",
+                                                     blue, false, 0.f));
+    ASSERT_TRUE(stage->GetPrimAtPath(PXR_NS::SdfPath("/a"))
+                    .GetAttribute(PXR_NS::TfToken("color"))
+                    .Get(&color));
+    ASSERT_EQ(color, PXR_NS::GfVec3f(0, 0, 1));
+
+    // Nothing is set when the sizes do not match.
+    Amino::Array<Bifrost::Math::float3> one{{1, 1, 1}};
+    ASSERT_FALSE(USD::Attribute::set_prims_attribute(stage, paths, "color",
+                                                     one, false, 0.f));
+}
+
+TEST(AttributeNodeDefs, DISABLED_set_prims_attribute_benchmark) {
+    constexpr int kNumPrims = 50000;
+
+    BifrostUsd::Stage           stage;
+    Amino::Array<Amino::String> paths;
+    Amino::Array<Amino::float_t> values;
+    for (int i = 0; i < kNumPrims; ++i) {
+        auto path = "/instances/instance" + std::to_string(i);
+        stage->DefinePrim(PXR_NS::SdfPath(path))
+            .CreateAttribute(PXR_NS::TfToken("id"),
+                             PXR_NS::SdfValueTypeNames->Float);
+        paths.push_back(path.c_str());
+        values.push_back(static_cast<float>(i));
+    }
+
+    // One set_prim_attribute per prim, as done by a for_each loop.
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < kNumPrims; ++i) {
+        USD::Attribute::set_prim_attribute(stage, paths[i], "id", values[i],
+                                           true, 1.f);
+    }
+    auto middle = std::chrono::steady_clock::now();
+    ASSERT_TRUE(USD::Attribute::set_prims_attribute(stage, paths, "id", values,
+                                                    true, 2.f));
+    auto end = std::chrono::steady_clock::now();
+
+    std::cout << "set_prim_attribute: " << kNumPrims << " prims in "
+              << std::chrono::duration<double, std::milli>(middle - start).count()
+              << " ms" << std::endl;
+    std::cout << "set_prims_attribute: " << kNumPrims << " prims in "
+              << std::chrono::duration<double, std::milli>(end - middle).count()
+              << " ms" << std::endl;
+}
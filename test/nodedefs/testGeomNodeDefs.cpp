@@ -14,6 +14,8 @@
 // limitations under the License.
 //+
 #include <Amino/Core/String.h>
+#include <Bifrost/Geometry/GeoProperty.h>
+#include <Bifrost/Geometry/Primitives.h>
 #include <gtest/gtest.h>
 #include <nodedefs/usd_pack/usd_attribute_nodedefs.h>
 #include <nodedefs/usd_pack/usd_geom_nodedefs.h>
@@ -24,8 +26,11 @@
 
 BIFUSD_WARNING_PUSH
 BIFUSD_WARNING_DISABLE_MSC(4003)
+#include <pxr/usd/usdGeom/basisCurves.h>
 #include <pxr/usd/usdGeom/boundable.h>
 #include <pxr/usd/usdGeom/mesh.h>
+#include <pxr/usd/usdGeom/nurbsCurves.h>
+#include <pxr/usd/usdGeom/primvarsAPI.h>
 #include <pxr/usd/usdGeom/sphere.h>
 #include <pxr/usd/usdGeom/xformCommonAPI.h>
 
@@ -201,6 +206,224 @@ TEST(GeomNodeDefs, get_usd_point_positions) {
     }
 }
 
+namespace {
+void defineQuadMesh(PXR_NS::UsdStageRefPtr const& stage,
+                    const char*                   path,
+                    float                         offset) {
+    auto mesh = PXR_NS::UsdGeomMesh::Define(stage, PXR_NS::SdfPath(path));
+    mesh.CreatePointsAttr(PXR_NS::VtValue(PXR_NS::VtVec3fArray{
+        {offset, 0, 0}, {offset + 1, 0, 0}, {offset + 1, 1, 0}, {offset, 1, 0}}));
+    mesh.CreateFaceVertexCountsAttr(PXR_NS::VtValue(PXR_NS::VtIntArray{4}));
+    mesh.CreateFaceVertexIndicesAttr(
+        PXR_NS::VtValue(PXR_NS::VtIntArray{0, 1, 2, 3}));
+}
+} // namespace
+
+TEST(GeomNodeDefs, get_usd_geom_meshes) {
+    auto stage    = Amino::newMutablePtr<BifrostUsd::Stage>();
+    auto pxrStage = stage->getStagePtr();
+    ASSERT_TRUE(pxrStage);
+
+    defineQuadMesh(pxrStage, "/root/a", 0.f);
+    defineQuadMesh(pxrStage, "/root/b", 2.f);
+    defineQuadMesh(pxrStage, "/root/excluded/c", 4.f);
+
+    // Give "/root/a" indexed face-varying UVs and normals, and a display color.
+    auto meshA =
+        PXR_NS::UsdGeomMesh::Get(pxrStage, PXR_NS::SdfPath("/root/a"));
+    meshA.CreateNormalsAttr(PXR_NS::VtValue(PXR_NS::VtVec3fArray(
+        4, PXR_NS::GfVec3f(0, 0, 1))));
+    meshA.SetNormalsInterpolation(PXR_NS::UsdGeomTokens->faceVarying);
+    auto st = PXR_NS::UsdGeomPrimvarsAPI(meshA).CreatePrimvar(
+        PXR_NS::TfToken("st"), PXR_NS::SdfValueTypeNames->TexCoord2fArray,
+        PXR_NS::UsdGeomTokens->faceVarying);
+    st.Set(PXR_NS::VtVec2fArray{{0, 0}, {1, 1}});
+    st.SetIndices(PXR_NS::VtIntArray{0, 1, 1, 0});
+    meshA.CreateDisplayColorPrimvar().Set(
+        PXR_NS::VtVec3fArray{PXR_NS::GfVec3f(0, 1, 0)});
+
+    // A mesh with a face referring to a missing point is skipped.
+    auto bad = PXR_NS::UsdGeomMesh::Define(pxrStage,
+                                           PXR_NS::SdfPath("/root/bad"));
+    bad.CreatePointsAttr(PXR_NS::VtValue(PXR_NS::VtVec3fArray{{0, 0, 0}}));
+    bad.CreateFaceVertexCountsAttr(PXR_NS::VtValue(PXR_NS::VtIntArray{3}));
+    bad.CreateFaceVertexIndicesAttr(
+        PXR_NS::VtValue(PXR_NS::VtIntArray{0, 1, 2}));
+
+    Amino::Array<Amino::String> excludes{"/root/excluded"};
+    Amino::MutablePtr<Amino::Array<Amino::Ptr<Bifrost::Object>>> meshes;
+    ASSERT_TRUE(USD::Prim::get_usd_geom_meshes(*stage, "/root", excludes,
+                                               true, "st", 0.f, meshes));
+    ASSERT_TRUE(meshes != nullptr);
+    ASSERT_EQ(meshes->size(), 2u);
+
+    // Meshes are returned in traversal order.
+    auto const& objA = *(*meshes)[0];
+    auto const& objB = *(*meshes)[1];
+    auto pathA = objA.getProperty("prim_path");
+    auto pathB = objB.getProperty("prim_path");
+    ASSERT_TRUE(Amino::any_cast<Amino::String>(&pathA) != nullptr);
+    ASSERT_TRUE(Amino::any_cast<Amino::String>(&pathB) != nullptr);
+    ASSERT_EQ(*Amino::any_cast<Amino::String>(&pathA), "/root/a");
+    ASSERT_EQ(*Amino::any_cast<Amino::String>(&pathB), "/root/b");
+
+    auto positions = Bifrost::Geometry::getDataGeoPropValues<
+        Bifrost::Math::float3>(objB, Bifrost::Geometry::sPositions);
+    ASSERT_TRUE(positions != nullptr);
+    ASSERT_EQ(positions->size(), 4u);
+    ASSERT_FLOAT_EQ((*positions)[0].x, 2.f);
+
+    ASSERT_TRUE(objA.hasProperty("face_vertex_normal"));
+    ASSERT_TRUE(objA.hasProperty("face_vertex_uv"));
+    ASSERT_TRUE(objA.hasProperty("point_color"));
+    ASSERT_FALSE(objB.hasProperty("face_vertex_normal"));
+    ASSERT_TRUE(objB.hasProperty("point_normal"));
+
+    auto uvIndices = Bifrost::Geometry::getDataGeoPropValues<
+        Bifrost::Geometry::Index>(objA, "face_vertex_uv_index");
+    ASSERT_TRUE(uvIndices != nullptr);
+    ASSERT_EQ(uvIndices->size(), 4u);
+    ASSERT_EQ((*uvIndices)[2], 1u);
+
+    // Uniform colors are mapped to the points of their faces.
+    auto meshB = PXR_NS::UsdGeomMesh::Get(pxrStage, PXR_NS::SdfPath("/root/b"));
+    meshB.CreateDisplayColorPrimvar(PXR_NS::UsdGeomTokens->uniform)
+        .Set(PXR_NS::VtVec3fArray{PXR_NS::GfVec3f(0, 0, 1)});
+    // The primvars:normals primvar takes precedence over the normals.
+    meshB.CreateNormalsAttr(PXR_NS::VtValue(
+        PXR_NS::VtVec3fArray(4, PXR_NS::GfVec3f(0, 0, 1))));
+    PXR_NS::UsdGeomPrimvarsAPI(meshB)
+        .CreatePrimvar(PXR_NS::UsdGeomTokens->primvarsNormals,
+                       PXR_NS::SdfValueTypeNames->Normal3fArray,
+                       PXR_NS::UsdGeomTokens->vertex)
+        .Set(PXR_NS::VtVec3fArray(4, PXR_NS::GfVec3f(1, 0, 0)));
+    // Abstract prims are not read.
+    defineQuadMesh(pxrStage, "/root/_class", 6.f);
+    pxrStage->GetPrimAtPath(PXR_NS::SdfPath("/root/_class"))
+        .SetSpecifier(PXR_NS::SdfSpecifierClass);
+    ASSERT_TRUE(USD::Prim::get_usd_geom_meshes(*stage, "/root", excludes,
+                                               true, "st", 0.f, meshes));
+    ASSERT_EQ(meshes->size(), 2u);
+    auto colorsB = Bifrost::Geometry::getDataGeoPropValues<
+        Bifrost::Math::float3>(*(*meshes)[1], "point_color");
+    ASSERT_TRUE(colorsB != nullptr);
+    ASSERT_EQ(colorsB->size(), 4u);
+    ASSERT_FLOAT_EQ((*colorsB)[3].z, 1.f);
+    auto normalsB = Bifrost::Geometry::getDataGeoPropValues<
+        Bifrost::Math::float3>(*(*meshes)[1], "face_vertex_normal");
+    ASSERT_TRUE(normalsB != nullptr);
+    ASSERT_EQ(normalsB->size(), 4u);
+    ASSERT_FLOAT_EQ((*normalsB)[0].x, 1.f);
+
+    // Excluding the root prim excludes everything.
+    Amino::Array<Amino::String> excludeAll{"/root"};
+    ASSERT_TRUE(USD::Prim::get_usd_geom_meshes(*stage, "/root", excludeAll,
+                                               false, "st", 0.f, meshes));
+    ASSERT_TRUE(meshes->empty());
+
+    // An invalid root prim path is reported as a failure.
+    ASSERT_FALSE(USD::Prim::get_usd_geom_meshes(*stage, "/missing", {}, false,
+                                                "st", 0.f, meshes));
+    ASSERT_TRUE(meshes->empty());
+}
+
+TEST(GeomNodeDefs, get_usd_geom_curves) {
+    auto stage    = Amino::newMutablePtr<BifrostUsd::Stage>();
+    auto pxrStage = stage->getStagePtr();
+    ASSERT_TRUE(pxrStage);
+
+    // Two curves of 3 and 2 points, with per curve widths and colors.
+    auto basis = PXR_NS::UsdGeomBasisCurves::Define(
+        pxrStage, PXR_NS::SdfPath("/root/basis"));
+    basis.CreatePointsAttr(PXR_NS::VtValue(PXR_NS::VtVec3fArray{
+        {0, 0, 0}, {0, 1, 0}, {0, 2, 0}, {1, 0, 0}, {1, 1, 0}}));
+    basis.CreateCurveVertexCountsAttr(PXR_NS::VtValue(PXR_NS::VtIntArray{3, 2}));
+    basis.CreateWidthsAttr(PXR_NS::VtValue(PXR_NS::VtFloatArray{0.5f, 0.25f}));
+    basis.SetWidthsInterpolation(PXR_NS::UsdGeomTokens->uniform);
+    basis.CreateDisplayColorPrimvar(PXR_NS::UsdGeomTokens->uniform)
+        .Set(PXR_NS::VtVec3fArray{PXR_NS::GfVec3f(0, 0, 1),
+                                  PXR_NS::GfVec3f(1, 0, 0)});
+
+    auto nurbs = PXR_NS::UsdGeomNurbsCurves::Define(
+        pxrStage, PXR_NS::SdfPath("/root/nurbs"));
+    nurbs.CreatePointsAttr(PXR_NS::VtValue(PXR_NS::VtVec3fArray{
+        {0, 0, 0}, {1, 0, 0}, {2, 0, 0}, {3, 0, 0}}));
+    nurbs.CreateCurveVertexCountsAttr(PXR_NS::VtValue(PXR_NS::VtIntArray{4}));
+
+    // Curves whose vertex counts do not match their points are skipped.
+    auto bad = PXR_NS::UsdGeomBasisCurves::Define(
+        pxrStage, PXR_NS::SdfPath("/root/bad"));
+    bad.CreatePointsAttr(PXR_NS::VtValue(PXR_NS::VtVec3fArray{{0, 0, 0}}));
+    bad.CreateCurveVertexCountsAttr(PXR_NS::VtValue(PXR_NS::VtIntArray{2}));
+
+    Amino::MutablePtr<Amino::Array<Amino::Ptr<Bifrost::Object>>> strands;
+    ASSERT_TRUE(USD::Prim::get_usd_geom_curves(*stage, "/root", {}, true, 0.f,
+                                               strands));
+    ASSERT_TRUE(strands != nullptr);
+    ASSERT_EQ(strands->size(), 2u);
+
+    auto const& objBasis = *(*strands)[0];
+    auto const& objNurbs = *(*strands)[1];
+
+    auto offsets = Bifrost::Geometry::getDataGeoPropValues<
+        Bifrost::Geometry::Index>(objBasis, Bifrost::Geometry::sStrandOffsets);
+    ASSERT_TRUE(offsets != nullptr);
+    ASSERT_EQ(offsets->size(), 3u);
+    ASSERT_EQ((*offsets)[0], 0u);
+    ASSERT_EQ((*offsets)[1], 3u);
+    ASSERT_EQ((*offsets)[2], 5u);
+
+    auto widths = Bifrost::Geometry::getDataGeoPropValues<Amino::float_t>(
+        objBasis, "point_size");
+    ASSERT_TRUE(widths != nullptr);
+    ASSERT_EQ(widths->size(), 5u);
+    ASSERT_FLOAT_EQ((*widths)[2], 0.5f);
+    ASSERT_FLOAT_EQ((*widths)[3], 0.25f);
+
+    auto colors = Bifrost::Geometry::getDataGeoPropValues<
+        Bifrost::Math::float3>(objBasis, "point_color");
+    ASSERT_TRUE(colors != nullptr);
+    ASSERT_EQ(colors->size(), 5u);
+    ASSERT_FLOAT_EQ((*colors)[2].z, 1.f);
+    ASSERT_FLOAT_EQ((*colors)[3].x, 1.f);
+
+    auto positions = Bifrost::Geometry::getDataGeoPropValues<
+        Bifrost::Math::float3>(objNurbs, Bifrost::Geometry::sPositions);
+    ASSERT_TRUE(positions != nullptr);
+    ASSERT_EQ(positions->size(), 4u);
+    ASSERT_FLOAT_EQ((*positions)[3].x, 3.f);
+    ASSERT_FALSE(objNurbs.hasProperty("point_size"));
+
+    // Excluded curves are skipped.
+    Amino::Array<Amino::String> excludes{"/root/basis"};
+    ASSERT_TRUE(USD::Prim::get_usd_geom_curves(*stage, "/root", excludes,
+                                               false, 0.f, strands));
+    ASSERT_EQ(strands->size(), 1u);
+    ASSERT_FALSE((*strands)[0]->hasProperty("point_color"));
+
+    // The varying widths of a cubic curve, one per segment end, are resampled
+    // to its points.
+    auto cubic = PXR_NS::UsdGeomBasisCurves::Define(
+        pxrStage, PXR_NS::SdfPath("/cubic"));
+    cubic.CreateTypeAttr(PXR_NS::VtValue(PXR_NS::UsdGeomTokens->cubic));
+    cubic.CreateBasisAttr(PXR_NS::VtValue(PXR_NS::UsdGeomTokens->bezier));
+    cubic.CreatePointsAttr(PXR_NS::VtValue(PXR_NS::VtVec3fArray(7)));
+    cubic.CreateCurveVertexCountsAttr(PXR_NS::VtValue(PXR_NS::VtIntArray{7}));
+    cubic.CreateWidthsAttr(
+        PXR_NS::VtValue(PXR_NS::VtFloatArray{1.f, 2.f, 3.f}));
+    cubic.SetWidthsInterpolation(PXR_NS::UsdGeomTokens->varying);
+    ASSERT_TRUE(USD::Prim::get_usd_geom_curves(*stage, "/cubic", {}, false,
+                                               0.f, strands));
+    ASSERT_EQ(strands->size(), 1u);
+    widths = Bifrost::Geometry::getDataGeoPropValues<Amino::float_t>(
+        *(*strands)[0], "point_size");
+    ASSERT_TRUE(widths != nullptr);
+    ASSERT_EQ(widths->size(), 7u);
+    ASSERT_FLOAT_EQ((*widths)[0], 1.f);
+    ASSERT_FLOAT_EQ((*widths)[3], 2.f);
+    ASSERT_FLOAT_EQ((*widths)[6], 3.f);
+}
+
 TEST(GeomNodeDefs, usd_point_instancer) {}
 
 TEST(GeomNodeDefs, usd_volume) {}
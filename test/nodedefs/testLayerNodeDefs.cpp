@@ -315,6 +315,35 @@ def Xform "hi"
     ASSERT_STREQ(result.c_str(), layerWithSublayerContent);
 }
 
+TEST(LayerNodeDefs, export_layer_to_string_chunks) {
+    for (const char* resource : {"helloworld.usd", "layer_with_sub_layers.usda"}) {
+        auto layer = Amino::newClassPtr<BifrostUsd::Layer>(
+            getResourcePath(resource).c_str(), "", "", false);
+        for (bool exportSubLayers : {false, true}) {
+            Amino::String result;
+            USD::Layer::export_layer_to_string(*layer, exportSubLayers, result);
+
+            Amino::MutablePtr<Amino::Array<Amino::String>> chunks;
+            USD::Layer::export_layer_to_string_chunks(*layer, exportSubLayers,
+                                                      chunks);
+            ASSERT_TRUE(chunks);
+            // One chunk for the metadata, then one for each root prim.
+            EXPECT_EQ(chunks->size(), 1 + (*layer)->GetRootPrims().size());
+
+            std::string joined;
+            for (const auto& chunk : *chunks) {
+                joined += chunk.c_str();
+            }
+            EXPECT_EQ(joined, result.c_str()) << resource;
+            EXPECT_EQ(layer->exportedSize(exportSubLayers), result.size());
+
+            Amino::long_t size = 0;
+            USD::Layer::get_layer_exported_size(*layer, exportSubLayers, size);
+            EXPECT_EQ(static_cast<size_t>(size), result.size());
+        }
+    }
+}
+
 TEST(LayerNodeDefs, export_layer_to_file) {
     const char* helloworldContent = R"usda(#usda 1.0
 
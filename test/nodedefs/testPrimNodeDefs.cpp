@@ -217,6 +217,99 @@ TEST(PrimNodeDefs, create_class_prim) {
     ASSERT_EQ(prim.GetSpecifier(), PXR_NS::SdfSpecifierClass);
 }
 
+TEST(PrimNodeDefs, define_prims) {
+    BifrostUsd::Stage stage;
+    USD::Prim::create_prim(stage, "/A", "Scope");
+
+    Amino::Array<Amino::String> paths = {"/A/B", "/A/C", "/D/E"};
+    Amino::Array<Amino::String> types = {"Sphere"};
+
+    auto radius = Bifrost::createObject();
+    radius->setProperty("name", Amino::String("radius"));
+    radius->setProperty("type", BifrostUsd::SdfValueTypeName::Double);
+    radius->setProperty("value", Amino::float_t(2.5f));
+    auto color = Bifrost::createObject();
+    color->setProperty("name", Amino::String("primvars:color"));
+    color->setProperty("type", BifrostUsd::SdfValueTypeName::Color3f);
+    color->setProperty("value", Bifrost::Math::float3{1.f, 0.f, 0.f});
+    color->setProperty("custom", true);
+    color->setProperty("use_frame", true);
+    color->setProperty("frame", 3.f);
+    color->setProperty("interpolation",
+                       BifrostUsd::UsdGeomPrimvarInterpolation::PrimVarConstant);
+    Amino::Array<Amino::Ptr<Bifrost::Object>> attributes;
+    attributes.push_back(std::move(radius));
+    attributes.push_back(std::move(color));
+
+    ASSERT_TRUE(USD::Prim::define_prims(stage, paths, types, attributes));
+    EXPECT_EQ(stage.last_modified_prim, "/D/E");
+
+    for (const auto& path : paths) {
+        auto prim = stage->GetPrimAtPath(PXR_NS::SdfPath(path.c_str()));
+        ASSERT_TRUE(prim);
+        EXPECT_TRUE(prim.IsDefined());
+        EXPECT_EQ(prim.GetTypeName(), PXR_NS::TfToken("Sphere"));
+
+        double radiusValue = 0.0;
+        ASSERT_TRUE(prim.GetAttribute(PXR_NS::TfToken("radius"))
+                        .Get(&radiusValue));
+        EXPECT_EQ(radiusValue, 2.5);
+
+        auto colorAttribute =
+            prim.GetAttribute(PXR_NS::TfToken("primvars:color"));
+        ASSERT_TRUE(colorAttribute);
+        EXPECT_TRUE(colorAttribute.IsCustom());
+        PXR_NS::GfVec3f colorValue;
+        ASSERT_TRUE(colorAttribute.Get(&colorValue, PXR_NS::UsdTimeCode(3.0)));
+        EXPECT_EQ(colorValue, PXR_NS::GfVec3f(1.f, 0.f, 0.f));
+        PXR_NS::TfToken interpolation;
+        ASSERT_TRUE(colorAttribute.GetMetadata(
+            PXR_NS::TfToken("interpolation"), &interpolation));
+        EXPECT_EQ(interpolation, PXR_NS::TfToken("constant"));
+    }
+
+    // Undefined ancestors are defined as typeless prims, like
+    // UsdStage::DefinePrim does, and existing prims are left untouched.
+    auto ancestor = stage->GetPrimAtPath(PXR_NS::SdfPath("/D"));
+    ASSERT_TRUE(ancestor);
+    EXPECT_TRUE(ancestor.IsDefined());
+    EXPECT_EQ(ancestor.GetTypeName(), PXR_NS::TfToken());
+    EXPECT_EQ(stage->GetPrimAtPath(PXR_NS::SdfPath("/A")).GetTypeName(),
+              PXR_NS::TfToken("Scope"));
+
+    // The number of types must match the number of prims.
+    Amino::Array<Amino::String> badTypes = {"Sphere", "Cube"};
+    EXPECT_FALSE(USD::Prim::define_prims(stage, paths, badTypes, {}));
+
+    // An array of values for an attribute that is not an array gives one
+    // value per prim.
+    auto sizes = Amino::newMutablePtr<Amino::Array<Amino::float_t>>();
+    sizes->push_back(1.f);
+    sizes->push_back(2.f);
+    sizes->push_back(3.f);
+    auto perPrimRadius = Bifrost::createObject();
+    perPrimRadius->setProperty("name", Amino::String("radius"));
+    perPrimRadius->setProperty("type", BifrostUsd::SdfValueTypeName::Double);
+    perPrimRadius->setProperty(
+        "value", Amino::Ptr<Amino::Array<Amino::float_t>>(sizes.toImmutable()));
+    Amino::Array<Amino::Ptr<Bifrost::Object>> perPrimAttributes;
+    perPrimAttributes.push_back(std::move(perPrimRadius));
+    ASSERT_TRUE(
+        USD::Prim::define_prims(stage, paths, types, perPrimAttributes));
+    for (size_t i = 0; i < paths.size(); ++i) {
+        double radiusValue = 0.0;
+        ASSERT_TRUE(stage->GetPrimAtPath(PXR_NS::SdfPath(paths[i].c_str()))
+                        .GetAttribute(PXR_NS::TfToken("radius"))
+                        .Get(&radiusValue));
+        EXPECT_EQ(radiusValue, static_cast<double>(i + 1));
+    }
+
+    // The number of values must match the number of prims.
+    Amino::Array<Amino::String> twoPaths = {"/A/B", "/A/C"};
+    EXPECT_FALSE(
+        USD::Prim::define_prims(stage, twoPaths, types, perPrimAttributes));
+}
+
 TEST(PrimNodeDefs, add_applied_schema) {
     BifrostUsd::Stage stage;
     auto              primPath = PXR_NS::SdfPath("/S");
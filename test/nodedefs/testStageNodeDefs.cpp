@@ -26,15 +26,19 @@
 #include <pxr/usd/usdUtils/stageCache.h>
 #include <utils/test/testUtils.h>
 
+#include <chrono>
 #include <fstream>
+#include <iostream>
 #include <regex>
 #include <string>
+#include <utility>
 
 // Note: To silence warnings coming from USD library
 #include <bifusd/config/CfgWarningMacros.h>
 BIFUSD_WARNING_PUSH
 BIFUSD_WARNING_DISABLE_MSC(4003)
 #include <pxr/usd/usd/modelAPI.h>
+#include <pxr/usd/usd/primRange.h>
 BIFUSD_WARNING_POP
 
 using namespace BifrostUsd::TestUtils;
@@ -495,7 +499,7 @@ TEST(StageNodeDefs, open_stage_from_cache) {
                       .ToLongInt();
 
         auto stage = Amino::newClassPtr<BifrostUsd::Stage>();
-        USD::Stage::open_stage_from_cache(id, -1, stage);
+        USD::Stage::open_stage_from_cache(id, -1, false, stage);
         ASSERT_TRUE(*stage);
         auto prim = stage->get().GetPrimAtPath(PXR_NS::SdfPath("/hello/world"));
         ASSERT_TRUE(prim.IsValid());
@@ -546,7 +550,7 @@ TEST(StageNodeDefs, open_stage_from_cache) {
                       .ToLongInt();
 
         Amino::Ptr<BifrostUsd::Stage> stage;
-        USD::Stage::open_stage_from_cache(id, -1, stage);
+        USD::Stage::open_stage_from_cache(id, -1, false, stage);
         ASSERT_TRUE(stage);
         ASSERT_TRUE(*stage);
         ASSERT_TRUE(std::regex_match(
@@ -554,7 +558,7 @@ TEST(StageNodeDefs, open_stage_from_cache) {
             std::regex("anon:.*:open_stage_from_cache_root.usda")));
 
         stage.reset();
-        USD::Stage::open_stage_from_cache(id, 0, stage);
+        USD::Stage::open_stage_from_cache(id, 0, false, stage);
         ASSERT_TRUE(stage);
         ASSERT_TRUE(*stage);
         ASSERT_TRUE(std::regex_match(
@@ -562,7 +566,7 @@ TEST(StageNodeDefs, open_stage_from_cache) {
             std::regex("anon:.*:open_stage_from_cache_a.usda")));
 
         stage.reset();
-        USD::Stage::open_stage_from_cache(id, 1, stage);
+        USD::Stage::open_stage_from_cache(id, 1, false, stage);
         ASSERT_TRUE(stage);
         ASSERT_TRUE(*stage);
         ASSERT_TRUE(std::regex_match(
@@ -571,6 +575,100 @@ TEST(StageNodeDefs, open_stage_from_cache) {
     }
 }
 
+TEST(StageNodeDefs, open_stage_from_cache_reuse) {
+    auto pxrStage = PXR_NS::UsdStage::Open(
+        getResourcePath("layer_with_sub_layers.usda").c_str());
+    ASSERT_TRUE(pxrStage);
+    auto id = PXR_NS::UsdUtilsStageCache::Get().Insert(pxrStage).ToLongInt();
+
+    // Reading the stage: the cached UsdStage is used as is.
+    Amino::Ptr<BifrostUsd::Stage> stage;
+    USD::Stage::open_stage_from_cache(id, -1, true, stage);
+    ASSERT_TRUE(stage);
+    ASSERT_TRUE(*stage);
+    EXPECT_EQ(stage->getSharedStagePtr(), pxrStage);
+    EXPECT_TRUE(stage->get().GetPrimAtPath(PXR_NS::SdfPath("/hi/world")));
+    EXPECT_TRUE(stage->get().GetPrimAtPath(PXR_NS::SdfPath("/hello/world")));
+    ASSERT_EQ(stage->getRootLayer()->getSubLayers().size(), 1);
+
+    // Modifying the stage: the cached UsdStage and its layers are left
+    // untouched, and the sublayers that are not edited are still shared.
+    {
+        auto modified = Amino::newMutablePtr<BifrostUsd::Stage>(*stage);
+        ASSERT_TRUE(modified->get().DefinePrim(PXR_NS::SdfPath("/bifrost")));
+        EXPECT_NE(modified->getSharedStagePtr(), pxrStage);
+        EXPECT_TRUE(std::as_const(*modified)->GetPrimAtPath(
+            PXR_NS::SdfPath("/hello/world")));
+        EXPECT_FALSE(pxrStage->GetPrimAtPath(PXR_NS::SdfPath("/bifrost")));
+        EXPECT_EQ(
+            std::as_const(*modified).getRootLayer()->getSubLayers()[0]
+                ->GetIdentifier(),
+            stage->getRootLayer()->getSubLayers()[0]->GetIdentifier());
+    }
+    EXPECT_EQ(stage->getSharedStagePtr(), pxrStage);
+
+    // With a sublayer as EditTarget, the sublayer is copied right away.
+    stage.reset();
+    USD::Stage::open_stage_from_cache(id, 0, true, stage);
+    ASSERT_TRUE(stage);
+    ASSERT_TRUE(*stage);
+    EXPECT_NE(stage->getSharedStagePtr(), pxrStage);
+    EXPECT_TRUE(std::regex_match(
+        stage->get().GetEditTarget().GetLayer()->GetIdentifier().c_str(),
+        std::regex("anon:.*:helloworld.usd")));
+    EXPECT_TRUE(stage->get().GetPrimAtPath(PXR_NS::SdfPath("/hello/world")));
+
+    PXR_NS::UsdUtilsStageCache::Get().Erase(pxrStage);
+}
+
+TEST(StageNodeDefs, DISABLED_open_stage_from_cache_benchmark) {
+    const int numEvaluations = 100;
+
+    auto pxrStage = PXR_NS::UsdStage::Open(
+        getResourcePath(
+            Amino::Array<Amino::String>{"kitchen_set", "kitchen_props.usd"})
+            .c_str());
+    ASSERT_TRUE(pxrStage);
+    auto id = PXR_NS::UsdUtilsStageCache::Get().Insert(pxrStage).ToLongInt();
+
+    using Clock  = std::chrono::steady_clock;
+    auto elapsed = [](Clock::time_point start) {
+        return std::chrono::duration<double>(Clock::now() - start).count();
+    };
+
+    // One open_stage_from_cache per graph evaluation, followed by a read of
+    // the whole stage.
+    auto evaluate = [&](bool reuseCachedStage) {
+        for (int i = 0; i < numEvaluations; ++i) {
+            Amino::Ptr<BifrostUsd::Stage> stage;
+            USD::Stage::open_stage_from_cache(id, -1, reuseCachedStage, stage);
+            EXPECT_TRUE(stage && *stage);
+            size_t numPrims = 0;
+            for (const auto& prim :
+                 PXR_NS::UsdPrimRange(stage->get().GetPseudoRoot())) {
+                numPrims += prim.IsValid() ? 1 : 0;
+            }
+            EXPECT_GT(numPrims, 0u);
+        }
+    };
+
+    auto start = Clock::now();
+    evaluate(false);
+    const double reloadTime = elapsed(start);
+
+    start = Clock::now();
+    evaluate(true);
+    const double reuseTime = elapsed(start);
+
+    PXR_NS::UsdUtilsStageCache::Get().Erase(pxrStage);
+
+    std::cout << numEvaluations
+              << " evaluations of open_stage_from_cache on kitchen_props.usd:\n"
+              << "    reloaded stage: " << reloadTime << " s\n"
+              << "    reused stage:   " << reuseTime << " s" << std::endl;
+    EXPECT_LT(reuseTime, reloadTime);
+}
+
 TEST(StageNodeDefs, send_stage_to_cache) {
     auto stage = Amino::newClassPtr<BifrostUsd::Stage>(
         getResourcePath("helloworld.usd").c_str());
@@ -619,6 +717,27 @@ def Xform "hi"
     ASSERT_STREQ(result.c_str(), flattenedFileContent);
 }
 
+TEST(StageNodeDefs, export_stage_to_string_chunks) {
+    BifrostUsd::Stage stage{
+        getResourcePath("layer_with_sub_layers.usda").c_str()};
+    ASSERT_TRUE(stage);
+
+    Amino::String result = "";
+    USD::Stage::export_stage_to_string(stage, result);
+
+    Amino::MutablePtr<Amino::Array<Amino::String>> chunks;
+    USD::Stage::export_stage_to_string_chunks(stage, chunks);
+    ASSERT_TRUE(chunks);
+    // The metadata, then the "hello" and "hi" root prims.
+    ASSERT_EQ(chunks->size(), 3);
+
+    std::string joined;
+    for (const auto& chunk : *chunks) {
+        joined += chunk.c_str();
+    }
+    ASSERT_EQ(joined, result.c_str());
+}
+
 TEST(StageNodeDefs, export_stage_to_file) {
     BifrostUsd::Stage stage{
         getResourcePath("layer_with_sub_layers.usda").c_str()};
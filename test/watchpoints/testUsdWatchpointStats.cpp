@@ -0,0 +1,105 @@
+//-
+// Copyright 2023 Autodesk, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//+
+
+#include <BifrostUsd/Stage.h>
+
+#include <usd_watchpoint_stats.h>
+
+#include <pxr/usd/usdGeom/modelAPI.h>
+
+#include <gtest/gtest.h>
+#include <string>
+
+namespace {
+/// Defines an Xform root with enough Mesh children to be counted by several
+/// tasks. The root and one of the meshes have an applied API schema.
+void populateStage(BifrostUsd::Stage& stage, int numMeshes) {
+    auto root = stage->DefinePrim(PXR_NS::SdfPath("/root"),
+                                  PXR_NS::TfToken("Xform"));
+    PXR_NS::UsdGeomModelAPI::Apply(root);
+    for (int i = 0; i < numMeshes; ++i) {
+        auto mesh = stage->DefinePrim(
+            PXR_NS::SdfPath("/root/mesh" + std::to_string(i)),
+            PXR_NS::TfToken("Mesh"));
+        if (i == 1) PXR_NS::UsdGeomModelAPI::Apply(mesh);
+    }
+    stage->DefinePrim(PXR_NS::SdfPath("/root/mesh0/child"),
+                      PXR_NS::TfToken("Scope"));
+}
+} // namespace
+
+TEST(UsdWatchpoint, computeStageStats) {
+    BifrostUsd::Stage stage;
+    populateStage(stage, 100);
+
+    // The applied schemas are counted once per prim they are applied to.
+    EXPECT_EQ(computeStageStats(stage.get()),
+              "Total Prims: 102\n"
+              "GeomModelAPI Count: 2\n"
+              "Mesh Count: 100\n"
+              "Scope Count: 1\n"
+              "Xform Count: 1\n");
+
+    // Inactive prims are counted too, like TraverseAll() does.
+    stage->GetPrimAtPath(PXR_NS::SdfPath("/root/mesh2")).SetActive(false);
+    EXPECT_EQ(computeStageStats(stage.get()),
+              "Total Prims: 102\n"
+              "GeomModelAPI Count: 2\n"
+              "Mesh Count: 100\n"
+              "Scope Count: 1\n"
+              "Xform Count: 1\n");
+
+    BifrostUsd::Stage emptyStage;
+    EXPECT_EQ(computeStageStats(emptyStage.get()), "Total Prims: 0\n");
+}
+
+TEST(UsdWatchpoint, stageStatsInvalidation) {
+    BifrostUsd::Stage stage;
+    populateStage(stage, 10);
+
+    USDWPStageStats stats;
+    const std::string initial = stats.get(stage);
+    EXPECT_EQ(initial, computeStageStats(stage.get()));
+    EXPECT_EQ(stats.get(stage), initial);
+
+    // Adding a prim resyncs it, the stats are computed again.
+    stage->DefinePrim(PXR_NS::SdfPath("/root/extra"),
+                      PXR_NS::TfToken("Scope"));
+    const std::string added = stats.get(stage);
+    EXPECT_NE(added, initial);
+    EXPECT_EQ(added, computeStageStats(stage.get()));
+
+    // Applying a schema changes the stats too.
+    PXR_NS::UsdGeomModelAPI::Apply(
+        stage->GetPrimAtPath(PXR_NS::SdfPath("/root/extra")));
+    const std::string applied = stats.get(stage);
+    EXPECT_NE(applied, added);
+    EXPECT_EQ(applied, computeStageStats(stage.get()));
+
+    // Removing a prim is seen as well.
+    stage->RemovePrim(PXR_NS::SdfPath("/root/extra"));
+    EXPECT_EQ(stats.get(stage), initial);
+
+    // Another stage is traversed on its own.
+    BifrostUsd::Stage otherStage;
+    EXPECT_EQ(stats.get(otherStage), "Total Prims: 0\n");
+
+    // And edits of the first stage are no longer tracked once it is
+    // replaced, but are seen when it is recorded again.
+    stage->DefinePrim(PXR_NS::SdfPath("/other"), PXR_NS::TfToken("Scope"));
+    EXPECT_EQ(stats.get(otherStage), "Total Prims: 0\n");
+    EXPECT_EQ(stats.get(stage), computeStageStats(stage.get()));
+}